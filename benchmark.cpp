@@ -0,0 +1,46 @@
+/***********************************************************************
+ * Source:
+ *    Benchmark
+ * Summary:
+ *    Driver to time the containers in this project against each other.
+ *    Each workload runs at a range of sizes and prints one line per
+ *    size, so the growth of the cost is as easy to see as the cost.
+ *
+ *    This is not part of the unit test build. Build it with
+ *    optimization and without DEBUG:
+ *       g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+ *       benchmark [largest]
+ *    where largest (default 1000000) caps the element counts. The
+ *    sorts run at 1M and 50M elements, as far as largest allows.
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#include "benchmark.h"              // for TIMEMS
+#include "benchmarkUnrolledList.h"  // for BENCHMARKUNROLLEDLIST
+#include "benchmarkPop.h"           // for BENCHMARKPOP
+#include "benchmarkReverse.h"       // for BENCHMARKREVERSE
+#include "benchmarkCompact.h"       // for BENCHMARKCOMPACT
+#include "benchmarkMixed.h"         // for BENCHMARKMIXED
+#include "benchmarkSort.h"          // for BENCHMARKSORT
+#include "benchmarkSnapshot.h"      // for BENCHMARKSNAPSHOT
+#include <cstdlib>                  // for STRTOULL
+
+/**********************************************************************
+ * MAIN
+ * Run every workload from 1,000 elements up to the largest size asked for
+ ***********************************************************************/
+int main(int argc, char** argv)
+{
+   size_t largest = argc > 1 ? (size_t)std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+   benchmarkUnrolledList(largest);
+   benchmarkPop(largest);
+   benchmarkMixed(largest);
+   benchmarkReverse(largest);
+   benchmarkSnapshot(largest);
+   benchmarkCompact(largest);
+   benchmarkSort(largest);
+
+   return 0;
+}
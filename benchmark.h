@@ -0,0 +1,45 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK
+ * Summary:
+ *    What every benchmark workload shares: a clock, somewhere to put
+ *    results so they are not optimized away, and a repeatable source
+ *    of random numbers
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>             // for STEADY_CLOCK
+#include <cstdio>             // for PRINTF
+#include <cstddef>            // for SIZE_T
+
+/**********************************************************************
+ * TIME MS
+ * Run the workload once and report how long it took in milliseconds
+ ***********************************************************************/
+template <class Workload>
+double timeMs(Workload work)
+{
+   auto begin = std::chrono::steady_clock::now();
+   work();
+   auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// results land here so the optimizer cannot drop the loops
+inline volatile long long sink;
+
+/**********************************************************************
+ * NEXT RANDOM
+ * A fixed xorshift, so every run and every container sees the same
+ * sequence of choices
+ ***********************************************************************/
+inline unsigned long long nextRandom(unsigned long long& state)
+{
+   state ^= state << 13;
+   state ^= state >> 7;
+   state ^= state << 17;
+   return state;
+}
@@ -0,0 +1,79 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK COMPACT
+ * Summary:
+ *    Time scans and drains of a churned list before and after compact()
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+
+/**********************************************************************
+ * COMPACT
+ * Scanning a list whose nodes were scattered by churn, before and after
+ * compact(), and draining it after an incremental or one-shot compact
+ ***********************************************************************/
+void compactWorkload(size_t num)
+{
+   // build the list by inserting at random spots so neighbours in the
+   // list are far apart in memory
+   custom::list<int> l;
+   unsigned long long state = 2463534242ull;
+   for (size_t i = 0; i < num; i++)
+   {
+      auto it = l.begin();
+      if (!l.empty())
+         l.advance(it, (ptrdiff_t)(nextRandom(state) % (l.size() < 64 ? l.size() : 64)));
+      l.insert(it, (int)i);
+   }
+   for (auto it = l.begin(); it != l.end(); )
+   {
+      it = l.erase(it);
+      if (it != l.end())
+         ++it;
+   }
+   for (size_t i = 0; i < num / 2; i++)
+      l.push_back((int)i);
+
+   auto scan = [&]()
+   {
+      long long sum = 0;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         sum += *it;
+      sink = sum;
+   };
+   double churned = timeMs(scan);
+   double compact = timeMs([&]() { l.compact(); });
+   double compacted = timeMs(scan);
+
+   custom::list<int> lIncremental(l);
+   custom::list<int> lOneShot(l);
+   double incremental = timeMs([&]()
+   {
+      for (auto it = lIncremental.begin(); it != lIncremental.end(); )
+         it = lIncremental.compact(it, 8);
+   });
+   lOneShot.compact();
+   double drainIncremental = timeMs([&]() { while (!lIncremental.empty()) lIncremental.pop_back(); });
+   double drainOneShot = timeMs([&]() { while (!lOneShot.empty()) lOneShot.pop_back(); });
+
+   printf("   n=%-10zu scan churned %8.2f ms   compact %8.2f ms   scan compacted %8.2f ms\n",
+          l.size(), churned, compact, compacted);
+   printf("   %-12s compact by 8 %8.2f ms   drain %8.2f ms   drain after one-shot %8.2f ms\n",
+          "", incremental, drainIncremental, drainOneShot);
+}
+
+/**********************************************************************
+ * BENCHMARK COMPACT
+ * From the smallest size up to the largest size asked for
+ ***********************************************************************/
+void benchmarkCompact(size_t largest)
+{
+   printf("compact\n");
+   for (size_t num = 1000; num <= largest; num *= 10)
+      compactWorkload(num);
+}
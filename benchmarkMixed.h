@@ -0,0 +1,293 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK MIXED
+ * Summary:
+ *    Time a random mix of inserts and erases on the sentinel ring that
+ *    list uses against the head/tail layout it replaced. Both stand-in
+ *    lists below recycle their nodes the same way, so what differs
+ *    between them is only the branching in insert and erase. To see
+ *    the mispredictions themselves, run the driver under
+ *       perf stat -e branches,branch-misses benchmark
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+#include <algorithm>          // for MIN
+#include <vector>             // for VECTOR
+
+/**********************************************************************
+ * NODE POOL
+ * Hands out nodes and takes them back, so neither stand-in list pays
+ * the allocator in the timed loop
+ ***********************************************************************/
+template <class Node>
+struct NodePool
+{
+   ~NodePool()
+   {
+      for (Node* p : spare)
+         delete p;
+   }
+   Node* get()
+   {
+      if (spare.empty())
+         return new Node;
+      Node* p = spare.back();
+      spare.pop_back();
+      return p;
+   }
+   void put(Node* p) { spare.push_back(p); }
+
+   std::vector<Node*> spare;
+};
+
+/**********************************************************************
+ * HEAD TAIL LIST
+ * The layout list had before the sentinel: null at both ends, so
+ * insert and erase branch on the empty list, the head, and the tail
+ ***********************************************************************/
+struct HeadTailList
+{
+   struct Node
+   {
+      int data;
+      Node* pNext;
+      Node* pPrev;
+   };
+   using iterator = Node*;
+
+   ~HeadTailList()
+   {
+      while (pHead)
+         erase(pHead);
+   }
+
+   iterator begin() { return pHead; }
+   iterator end() { return nullptr; }
+   iterator next(iterator it) { return it->pNext; }
+   bool empty() const { return numElements == 0; }
+
+   iterator insert(iterator it, int data)
+   {
+      Node* pNew = pool.get();
+      pNew->data = data;
+      pNew->pNext = pNew->pPrev = nullptr;
+
+      if (numElements == 0)
+      {
+         numElements = 1;
+         pHead = pTail = pNew;
+         return pNew;
+      }
+
+      if (it)
+      {
+         pNew->pNext = it;
+         pNew->pPrev = it->pPrev;
+         it->pPrev = pNew;
+         if (pNew->pPrev)
+            pNew->pPrev->pNext = pNew;
+         if (it == pHead)
+            pHead = pNew;
+      }
+      else
+      {
+         pTail->pNext = pNew;
+         pNew->pPrev = pTail;
+         pTail = pNew;
+      }
+      numElements++;
+      return pNew;
+   }
+
+   iterator erase(iterator it)
+   {
+      iterator itNext = nullptr;
+      if (it->pNext)
+      {
+         it->pNext->pPrev = it->pPrev;
+         itNext = it->pNext;
+      }
+      else
+         pTail = it->pPrev;
+
+      if (it->pPrev)
+         it->pPrev->pNext = it->pNext;
+      else
+         pHead = it->pNext;
+
+      pool.put(it);
+      numElements--;
+      return itNext;
+   }
+
+   NodePool<Node> pool;     // first in, so it is destroyed after the nodes go back
+   Node* pHead = nullptr;
+   Node* pTail = nullptr;
+   size_t numElements = 0;
+};
+
+/**********************************************************************
+ * SENTINEL LIST
+ * The layout list has now: a ring through a sentinel, so every insert
+ * and erase is the same four-pointer splice
+ ***********************************************************************/
+struct SentinelList
+{
+   struct Link
+   {
+      Link* pNext;
+      Link* pPrev;
+   };
+   struct Node : Link
+   {
+      int data;
+   };
+   using iterator = Link*;
+
+   SentinelList() { sentinel.pNext = sentinel.pPrev = &sentinel; }
+   ~SentinelList()
+   {
+      while (!empty())
+         erase(sentinel.pNext);
+   }
+
+   iterator begin() { return sentinel.pNext; }
+   iterator end() { return &sentinel; }
+   iterator next(iterator it) { return it->pNext; }
+   bool empty() const { return numElements == 0; }
+
+   iterator insert(iterator it, int data)
+   {
+      Node* pNew = pool.get();
+      pNew->data = data;
+      pNew->pNext = it;
+      pNew->pPrev = it->pPrev;
+      it->pPrev->pNext = pNew;
+      it->pPrev = pNew;
+      numElements++;
+      return pNew;
+   }
+
+   iterator erase(iterator it)
+   {
+      iterator itNext = it->pNext;
+      it->pPrev->pNext = itNext;
+      itNext->pPrev = it->pPrev;
+      pool.put(static_cast<Node*>(it));
+      numElements--;
+      return itNext;
+   }
+
+   NodePool<Node> pool;     // first in, so it is destroyed after the nodes go back
+   Link sentinel;
+   size_t numElements = 0;
+};
+
+/**********************************************************************
+ * CUSTOM LIST
+ * custom::list itself behind the same four calls, node cache and all
+ ***********************************************************************/
+struct CustomList
+{
+   using iterator = custom::list<int>::iterator;
+
+   iterator begin() { return l.begin(); }
+   iterator end() { return l.end(); }
+   iterator next(iterator it) { return ++it; }
+   bool empty() const { return l.empty(); }
+   iterator insert(iterator it, int data) { return l.insert(it, data); }
+   iterator erase(iterator it) { return l.erase(it); }
+
+   custom::list<int> l;
+};
+
+/**********************************************************************
+ * MIXED
+ * A cursor wanders a list of about width elements, inserting or
+ * erasing at random and now and then jumping to either end. In a
+ * short list the cursor is at the head, the tail or the end most of
+ * the time, which is where the head/tail layout branches at random.
+ ***********************************************************************/
+template <class List>
+double mixedWorkload(const std::vector<unsigned char>& ops, size_t width)
+{
+   List l;
+   for (size_t i = 0; i < width; i++)
+      l.insert(l.end(), (int)i);
+
+   double ms = timeMs([&]()
+   {
+      auto it = l.begin();
+      size_t size = width;
+      for (size_t i = 0; i < ops.size(); i++)
+      {
+         unsigned char op = ops[i];
+         bool grow = size < width / 2 + 1 || (size < width * 2 && (op & 1));
+         if (grow)
+         {
+            it = l.insert(it, (int)i);
+            size++;
+         }
+         else
+         {
+            if (it == l.end())
+               it = l.begin();
+            it = l.erase(it);
+            size--;
+         }
+
+         switch (op >> 1 & 3)
+         {
+            case 0:
+               break;
+            case 1:
+               if (it != l.end())
+                  it = l.next(it);
+               break;
+            case 2:
+               it = l.begin();
+               break;
+            case 3:
+               it = l.end();
+               break;
+         }
+      }
+   });
+   return ms * 1e6 / ops.size();
+}
+
+/**********************************************************************
+ * BENCHMARK MIXED
+ * The same stream of operations on each layout, in a short list where
+ * the ends come up all the time and in a long one where they do not
+ ***********************************************************************/
+void benchmarkMixed(size_t largest)
+{
+   printf("mixed insert and erase, head/tail layout vs sentinel ring\n");
+   for (size_t num = 1000; num <= largest; num *= 10)
+   {
+      unsigned long long state = 88172645463325252ull;
+      std::vector<unsigned char> ops(num);
+      for (size_t i = 0; i < num; i++)
+         ops[i] = (unsigned char)(nextRandom(state) >> 56);
+
+      // the best of three, so one descheduling does not decide it
+      for (size_t width : { 4, 1000 })
+      {
+         double headTail = 1e9, sentinel = 1e9, list = 1e9;
+         for (int run = 0; run < 3; run++)
+         {
+            headTail = std::min(headTail, mixedWorkload<HeadTailList>(ops, width));
+            sentinel = std::min(sentinel, mixedWorkload<SentinelList>(ops, width));
+            list = std::min(list, mixedWorkload<CustomList>(ops, width));
+         }
+         printf("   n=%-10zu width %-5zu head/tail %6.2f ns/op   sentinel %6.2f ns/op   list %6.2f ns/op\n",
+                num, width, headTail, sentinel, list);
+      }
+   }
+}
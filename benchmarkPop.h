@@ -0,0 +1,43 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK POP
+ * Summary:
+ *    Show that pop_front and pop_back cost the same per call at any size
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+
+/**********************************************************************
+ * POP
+ * The cost of each pop_front and pop_back should not depend on size
+ ***********************************************************************/
+void popWorkload(size_t num)
+{
+   custom::list<int> l;
+   for (size_t i = 0; i < num; i++)
+      l.push_back((int)i);
+   double front = timeMs([&]() { while (!l.empty()) l.pop_front(); });
+
+   for (size_t i = 0; i < num; i++)
+      l.push_back((int)i);
+   double back = timeMs([&]() { while (!l.empty()) l.pop_back(); });
+
+   printf("   n=%-10zu pop_front %7.2f ns/op   pop_back %7.2f ns/op\n",
+          num, front * 1e6 / num, back * 1e6 / num);
+}
+
+/**********************************************************************
+ * BENCHMARK POP
+ * From the smallest size up to the largest size asked for
+ ***********************************************************************/
+void benchmarkPop(size_t largest)
+{
+   printf("pop_front and pop_back\n");
+   for (size_t num = 10; num <= largest; num *= 10)
+      popWorkload(num);
+}
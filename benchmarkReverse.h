@@ -0,0 +1,48 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK REVERSE
+ * Summary:
+ *    Time the in-place reverse against rebuilding the list with push_front
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+
+/**********************************************************************
+ * REVERSE
+ * Flipping in place against the push_front rebuild it replaced
+ ***********************************************************************/
+void reverseWorkload(size_t num)
+{
+   custom::list<int> l;
+   for (size_t i = 0; i < num; i++)
+      l.push_back((int)i);
+
+   double inPlace = timeMs([&]() { l.reverse(); });
+
+   double rebuild = timeMs([&]()
+   {
+      custom::list<int> lReversed;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         lReversed.push_front(*it);
+      l = std::move(lReversed);
+   });
+
+   printf("   n=%-10zu reverse() %9.2f ms   push_front rebuild %9.2f ms\n",
+          num, inPlace, rebuild);
+}
+
+/**********************************************************************
+ * BENCHMARK REVERSE
+ * From the smallest size up to the largest size asked for
+ ***********************************************************************/
+void benchmarkReverse(size_t largest)
+{
+   printf("reverse\n");
+   for (size_t num = 1000; num <= largest; num *= 10)
+      reverseWorkload(num);
+}
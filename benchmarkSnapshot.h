@@ -0,0 +1,111 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK SNAPSHOT
+ * Summary:
+ *    Time and weigh snapshot copies of persistent_list against deep list copies
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+#include "persistent_list.h"
+#include <memory>             // for ALLOCATOR
+#include <vector>             // for VECTOR
+
+/**********************************************************************
+ * TALLY ALLOCATOR
+ * Counts the bytes live through it in a counter of its own. It is
+ * stateful, so lists never trade its nodes through the node cache and
+ * every byte a copy takes shows up in the count.
+ ***********************************************************************/
+template <class T>
+struct TallyAllocator
+{
+   using value_type = T;
+
+   TallyAllocator(long long* pBytes) : pBytes(pBytes) { }
+   template <class U>
+   TallyAllocator(const TallyAllocator<U>& rhs) : pBytes(rhs.pBytes) { }
+
+   T* allocate(size_t num)
+   {
+      *pBytes += num * sizeof(T);
+      return std::allocator<T>().allocate(num);
+   }
+   void deallocate(T* p, size_t num)
+   {
+      *pBytes -= num * sizeof(T);
+      std::allocator<T>().deallocate(p, num);
+   }
+
+   template <class U>
+   bool operator == (const TallyAllocator<U>& rhs) const { return pBytes == rhs.pBytes; }
+   template <class U>
+   bool operator != (const TallyAllocator<U>& rhs) const { return pBytes != rhs.pBytes; }
+
+   long long* pBytes;   // bytes allocated and not yet given back
+};
+
+/**********************************************************************
+ * SNAPSHOT
+ * Handing a list to many readers: a persistent_list copy shares every
+ * node, a list copy duplicates every node
+ ***********************************************************************/
+void snapshotWorkload(size_t num)
+{
+   const size_t numCopies = 100;
+   std::vector<int> v;
+   for (size_t i = 0; i < num; i++)
+      v.push_back((int)i);
+
+   long long deepBytes;
+   double deep;
+   {
+      long long live = 0;
+      TallyAllocator<int> alloc(&live);
+      custom::list<int, TallyAllocator<int>> l(v.begin(), v.end(), alloc);
+      std::vector<custom::list<int, TallyAllocator<int>>> copies;
+      copies.reserve(numCopies);
+      long long before = live;
+      deep = timeMs([&]()
+      {
+         for (size_t i = 0; i < numCopies; i++)
+            copies.emplace_back(l);
+      });
+      deepBytes = live - before;
+   }
+
+   long long sharedBytes;
+   double shared;
+   {
+      long long live = 0;
+      TallyAllocator<int> alloc(&live);
+      custom::persistent_list<int, TallyAllocator<int>> l(v.begin(), v.end(), alloc);
+      std::vector<custom::persistent_list<int, TallyAllocator<int>>> copies;
+      copies.reserve(numCopies);
+      long long before = live;
+      shared = timeMs([&]()
+      {
+         for (size_t i = 0; i < numCopies; i++)
+            copies.emplace_back(l);
+      });
+      sharedBytes = live - before;
+   }
+
+   printf("   n=%-10zu %zu copies: list %9.2f ms %12lld bytes   persistent_list %9.4f ms %12lld bytes\n",
+          num, numCopies, deep, deepBytes, shared, sharedBytes);
+}
+
+/**********************************************************************
+ * BENCHMARK SNAPSHOT
+ * From the smallest size up to the largest size asked for
+ ***********************************************************************/
+void benchmarkSnapshot(size_t largest)
+{
+   printf("snapshot copies\n");
+   for (size_t num = 1000; num <= largest; num *= 10)
+      snapshotWorkload(num);
+}
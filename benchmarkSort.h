@@ -0,0 +1,113 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK SORT
+ * Summary:
+ *    Time the list sorts against the vector round-trip and std::list::sort
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+#include <algorithm>          // for STABLE_SORT
+#include <list>               // for STD::LIST
+#include <thread>             // for HARDWARE_CONCURRENCY
+#include <vector>             // for VECTOR
+
+/**********************************************************************
+ * SORT
+ * The in-place sorts against the vector round-trip they replaced and
+ * std::list::sort. Each contestant builds its own container from the
+ * same random keys so only one of them is in memory at a time.
+ ***********************************************************************/
+template <class List>
+void fillRandom(List& l, size_t num)
+{
+   unsigned long long state = 1181783497276652981ull;
+   for (size_t i = 0; i < num; i++)
+      l.push_back((int)(nextRandom(state) >> 33));
+}
+
+void sortWorkload(size_t num)
+{
+   double member;
+   {
+      custom::list<int> l;
+      fillRandom(l, num);
+      member = timeMs([&]() { l.sort(); });
+   }
+
+   double radix;
+   {
+      custom::list<int> l;
+      fillRandom(l, num);
+      radix = timeMs([&]() { l.radix_sort(); });
+   }
+
+   double roundTrip;
+   {
+      custom::list<int> l;
+      fillRandom(l, num);
+      roundTrip = timeMs([&]()
+      {
+         std::vector<int> v(l.begin(), l.end());
+         std::stable_sort(v.begin(), v.end());
+         l = custom::list<int>(v.begin(), v.end());
+      });
+   }
+
+   double stdList;
+   {
+      std::list<int> l;
+      fillRandom(l, num);
+      stdList = timeMs([&]() { l.sort(); });
+   }
+
+   printf("   n=%-10zu sort %9.2f ms   radix_sort %9.2f ms\n",
+          num, member, radix);
+   printf("   %-12s vector round-trip %9.2f ms   std::list::sort %9.2f ms\n",
+          "", roundTrip, stdList);
+}
+
+/**********************************************************************
+ * PARALLEL SORT
+ * parallel_sort on 1 to 16 threads, each against sort() on the same
+ * keys. The core count is printed first, since the speedup should
+ * level off once the threads outnumber the cores.
+ ***********************************************************************/
+void parallelSortWorkload(size_t num)
+{
+   double member;
+   {
+      custom::list<int> l;
+      fillRandom(l, num);
+      member = timeMs([&]() { l.sort(); });
+   }
+
+   printf("   n=%-10zu on %u cores\n", num, std::thread::hardware_concurrency());
+   for (size_t numThreads : { 1, 2, 4, 8, 16 })
+   {
+      custom::list<int> l;
+      fillRandom(l, num);
+      double parallel = timeMs([&]() { l.parallel_sort(std::less<int>(), numThreads); });
+      printf("   %-12s parallel_sort %2zu threads %9.2f ms   speedup over sort() %5.2fx\n",
+             "", numThreads, parallel, member / parallel);
+   }
+}
+
+/**********************************************************************
+ * BENCHMARK SORT
+ * At 1M and 50M elements, as far as the largest size asked for allows
+ ***********************************************************************/
+void benchmarkSort(size_t largest)
+{
+   printf("sort\n");
+   for (size_t num : { 1000000, 50000000 })
+      if (num <= largest)
+      {
+         sortWorkload(num);
+         parallelSortWorkload(num);
+      }
+}
@@ -0,0 +1,73 @@
+/***********************************************************************
+ * Header:
+ *    BENCHMARK UNROLLED LIST
+ * Summary:
+ *    Time unrolled_list against list on the workloads it was built for
+ * Author
+ *    Br. Helfrich
+ ************************************************************************/
+
+#pragma once
+
+#include "benchmark.h"
+#include "list.h"
+#include "unrolled_list.h"
+
+/**********************************************************************
+ * UNROLLED vs LIST
+ * Full scan, a run of inserts in the middle, and erasing every other
+ * element, on both containers
+ ***********************************************************************/
+template <class List>
+void unrolledWorkload(const char* name, size_t num)
+{
+   List l;
+   for (size_t i = 0; i < num; i++)
+      l.push_back((int)i);
+
+   double scan = timeMs([&]()
+   {
+      long long sum = 0;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         sum += *it;
+      sink = sum;
+   });
+
+   size_t numInsert = num < 10000 ? num : 10000;
+   auto itMiddle = l.begin();
+   for (size_t i = 0; i < num / 2; i++)
+      ++itMiddle;
+   double insert = timeMs([&]()
+   {
+      for (size_t i = 0; i < numInsert; i++)
+         itMiddle = l.insert(itMiddle, (int)i);
+   });
+
+   double erase = timeMs([&]()
+   {
+      auto it = l.begin();
+      while (it != l.end())
+      {
+         it = l.erase(it);
+         if (it != l.end())
+            ++it;
+      }
+   });
+
+   printf("   %-10s n=%-10zu scan %9.2f ms   %zu middle inserts %9.2f ms   erase half %9.2f ms\n",
+          name, num, scan, numInsert, insert, erase);
+}
+
+/**********************************************************************
+ * BENCHMARK UNROLLED LIST
+ * From 1,000 elements up to the largest size asked for
+ ***********************************************************************/
+void benchmarkUnrolledList(size_t largest)
+{
+   printf("unrolled_list<int, 16> vs list<int>\n");
+   for (size_t num = 1000; num <= largest; num *= 10)
+   {
+      unrolledWorkload<custom::unrolled_list<int>>("unrolled", num);
+      unrolledWorkload<custom::list<int>>("list", num);
+   }
+}
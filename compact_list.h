@@ -0,0 +1,582 @@
+/***********************************************************************
+ * Header:
+ *    COMPACT LIST
+ * Summary:
+ *    A doubly linked list whose nodes live side by side in one
+ *    growable slab and point at each other with 32-bit indices
+ *    instead of pointers. A list<int> node takes 24 bytes plus the
+ *    allocator's overhead; here it takes 12, and neighbours in the
+ *    list tend to be neighbours in memory.
+ *
+ *    With split_layout the links and the payloads go in two
+ *    separate slabs, so a walk that only follows links reads
+ *    8 bytes a node no matter how big T is.
+ *
+ *    This will contain the class definition of:
+ *        inline_layout          : links and payload share a slot
+ *        split_layout           : links and payloads in their own slabs
+ *        compact_list           : a list stored in a slab
+ *        compact_list::iterator : an iterator through the list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstdint>     // for uint32_t
+#include <memory>      // for std::allocator
+#include <new>         // for placement new
+#include <stdexcept>   // for std::length_error
+#include <type_traits> // for std::conditional_t
+#include <utility>     // for std::move
+
+namespace custom
+{
+    /**************************************************
+     * COMPACT LIST LAYOUTS
+     * How a compact_list arranges its slots in memory.
+     * Slot i keeps the same number in either layout.
+     **************************************************/
+    struct inline_layout { };   // next, prev and the payload side by side
+    struct split_layout { };    // next and prev in one slab, payloads in another
+
+    /**************************************************
+     * COMPACT LIST
+     * Just like custom::list. Iterators hold the list and a
+     * slot index, so they stay valid when the slab grows;
+     * references and pointers to the elements do not.
+     * Slot 0 is the sentinel: its next is the head, its
+     * prev is the tail, and it is what end() refers to.
+     * Layout picks inline_layout or split_layout; the
+     * interface is the same either way.
+     **************************************************/
+    template <typename T, typename A = std::allocator<T>, typename Layout = inline_layout>
+    class compact_list
+    {
+    public:
+        using index = uint32_t;
+
+        //
+        // Construct
+        //
+
+        compact_list() :
+            nodes(nullptr), payloads(nullptr), capacity(0), used(0), freeHead(0), numElements(0), alloc() { }
+        explicit compact_list(const A& a) :
+            nodes(nullptr), payloads(nullptr), capacity(0), used(0), freeHead(0), numElements(0), alloc(a) { }
+        compact_list(const std::initializer_list<T>& il, const A& a = A());
+        compact_list(const compact_list& rhs);
+        compact_list(compact_list&& rhs);
+        ~compact_list();
+
+        //
+        // Assign
+        //
+
+        compact_list& operator = (const compact_list& rhs);
+        compact_list& operator = (compact_list&& rhs);
+
+        //
+        // Iterator
+        //
+
+        class iterator;
+        iterator begin() { return iterator(this, capacity ? nodes[0].next : 0); }
+        iterator end() { return iterator(this, 0); }
+
+        //
+        // Access
+        //
+
+        T& front() { assert(!empty()); return value(nodes[0].next); }
+        T& back() { assert(!empty()); return value(nodes[0].prev); }
+
+        //
+        // Insert
+        //
+
+        void push_front(const T& data) { insert(begin(), data); }
+        void push_front(T&& data) { insert(begin(), std::move(data)); }
+        void push_back(const T& data) { insert(end(), data); }
+        void push_back(T&& data) { insert(end(), std::move(data)); }
+        iterator insert(iterator it, const T& data) { return emplace(it, data); }
+        iterator insert(iterator it, T&& data) { return emplace(it, std::move(data)); }
+
+        //
+        // Remove
+        //
+
+        void pop_back() { if (!empty()) erase(iterator(this, nodes[0].prev)); }
+        void pop_front() { if (!empty()) erase(begin()); }
+        void clear();
+        iterator erase(const iterator& it);
+
+        //
+        // Status
+        //
+
+        bool empty() const { return numElements == 0; }
+        size_t size() const { return numElements; }
+        void reserve(size_t num);
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        static const bool split = std::is_same<Layout, split_layout>::value;
+
+        // room for one element
+        struct Payload
+        {
+            alignas(T) unsigned char data[sizeof(T)];
+
+            T& value() { return *reinterpret_cast<T*>(data); }
+        };
+
+        // the links of one slot
+        struct Link
+        {
+            index next;   // slot of the next node, 0 for the sentinel
+            index prev;   // slot of the previous node, freeSlot when unused
+        };
+
+        // one slot in the slab, with the payload unless it is split off
+        struct LinkedPayload : Link, Payload { };
+        using Node = std::conditional_t<split, Link, LinkedPayload>;
+
+        using node_allocator = typename std::allocator_traits<A>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+        using payload_allocator = typename std::allocator_traits<A>::template rebind_alloc<Payload>;
+        using payload_traits = std::allocator_traits<payload_allocator>;
+
+        // the element in a slot, wherever the layout keeps it
+        static Payload& payload(Node* nodes, Payload* payloads, index i)
+        {
+            if constexpr (split)
+                return payloads[i];
+            else
+                return nodes[i];
+        }
+        Payload& payload(index i) { return payload(nodes, payloads, i); }
+        T& value(index i) { return payload(i).value(); }
+        const T& value(index i) const { return payload(nodes, payloads, i).value(); }
+
+        // a slot that holds nothing has this in prev
+        static const index freeSlot = UINT32_MAX;
+
+        template <class U>
+        iterator emplace(iterator it, U&& data);
+        template <class U>
+        iterator place(iterator it, index i, U&& data);
+        index newSlot();
+        void grow(index newCapacity);
+        void release();
+
+        // member variables
+        Node* nodes;          // the slab, slot 0 being the sentinel
+        Payload* payloads;    // the elements under split_layout, parallel to nodes
+        index capacity;       // how many slots the slab holds
+        index used;           // slots [0, used) have been handed out at least once
+        index freeHead;       // first free slot below used, chained through next; 0 for none
+        size_t numElements;   // how many elements are in the list
+        node_allocator alloc; // where the slab comes from
+    };
+
+    /*************************************************
+     * COMPACT LIST ITERATOR
+     * A slot in a particular list
+     ************************************************/
+    template <typename T, typename A, typename Layout>
+    class compact_list <T, A, Layout> ::iterator
+    {
+    public:
+        iterator() : pList(nullptr), i(0) { }
+        iterator(compact_list* pList, index i) : pList(pList), i(i) { }
+
+        bool operator != (const iterator& rhs) const { return rhs.i != i || rhs.pList != pList; }
+        bool operator == (const iterator& rhs) const { return rhs.i == i && rhs.pList == pList; }
+
+        T& operator * () { return pList->value(i); }
+        T* operator -> () { return &pList->value(i); }
+
+        iterator& operator ++ () { i = pList->nodes[i].next; return *this; }
+        iterator operator ++ (int postfix) { iterator it(*this); ++*this; return it; }
+        iterator& operator -- () { i = pList->nodes[i].prev; return *this; }
+        iterator operator -- (int postfix) { iterator it(*this); --*this; return it; }
+
+        friend class compact_list <T, A, Layout>;
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        compact_list* pList;   // whose slab we are in
+        index i;               // which slot
+    };
+
+    /*****************************************
+     * COMPACT LIST :: INITIALIZER constructor
+     ****************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout> ::compact_list(const std::initializer_list<T>& il, const A& a) :
+        nodes(nullptr), payloads(nullptr), capacity(0), used(0), freeHead(0), numElements(0), alloc(a)
+    {
+        reserve(il.size());
+        for (const T& item : il)
+            push_back(item);
+    }
+
+    /*****************************************
+     * COMPACT LIST :: COPY constructor
+     * The copy comes out in list order, packed tight
+     ****************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout> ::compact_list(const compact_list& rhs) :
+        nodes(nullptr), payloads(nullptr), capacity(0), used(0), freeHead(0), numElements(0),
+        alloc(node_traits::select_on_container_copy_construction(rhs.alloc))
+    {
+        *this = rhs;
+    }
+
+    /*****************************************
+     * COMPACT LIST :: MOVE constructor
+     * Steal the slab from the RHS
+     ****************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout> ::compact_list(compact_list&& rhs) :
+        nodes(rhs.nodes), payloads(rhs.payloads), capacity(rhs.capacity), used(rhs.used), freeHead(rhs.freeHead),
+        numElements(rhs.numElements), alloc(std::move(rhs.alloc))
+    {
+        rhs.nodes = nullptr;
+        rhs.payloads = nullptr;
+        rhs.capacity = rhs.used = rhs.freeHead = 0;
+        rhs.numElements = 0;
+    }
+
+    /*****************************************
+     * COMPACT LIST :: DESTRUCTOR
+     ****************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout> ::~compact_list()
+    {
+        clear();
+        release();
+    }
+
+    /**********************************************
+     * COMPACT LIST :: assignment operator
+     * Copy one list onto another
+     *     INPUT  : a list to be copied
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of nodes
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout>& compact_list <T, A, Layout> :: operator = (const compact_list& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        clear();
+        reserve(rhs.numElements);
+        for (index i = rhs.capacity ? rhs.nodes[0].next : 0; i != 0; i = rhs.nodes[i].next)
+            push_back(rhs.value(i));
+        return *this;
+    }
+
+    /**********************************************
+     * COMPACT LIST :: assignment operator - MOVE
+     *     INPUT  : a list to be moved
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the size of the LHS
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    compact_list <T, A, Layout>& compact_list <T, A, Layout> :: operator = (compact_list&& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        // without the same allocator we cannot free their slab
+        if (!node_traits::propagate_on_container_move_assignment::value && alloc != rhs.alloc)
+        {
+            clear();
+            reserve(rhs.numElements);
+            for (index i = rhs.capacity ? rhs.nodes[0].next : 0; i != 0; i = rhs.nodes[i].next)
+                push_back(std::move(rhs.value(i)));
+            rhs.clear();
+            return *this;
+        }
+
+        clear();
+        release();
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+            alloc = std::move(rhs.alloc);
+
+        nodes = rhs.nodes;
+        payloads = rhs.payloads;
+        capacity = rhs.capacity;
+        used = rhs.used;
+        freeHead = rhs.freeHead;
+        numElements = rhs.numElements;
+
+        rhs.nodes = nullptr;
+        rhs.payloads = nullptr;
+        rhs.capacity = rhs.used = rhs.freeHead = 0;
+        rhs.numElements = 0;
+        return *this;
+    }
+
+    /*********************************************
+     * COMPACT LIST :: RESERVE
+     * Make room for num elements without growing again
+     *     INPUT  : how many elements to make room for
+     *     OUTPUT :
+     *     COST   : O(n) if the slab has to move
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    void compact_list <T, A, Layout> ::reserve(size_t num)
+    {
+        // one more slot for the sentinel, and freeSlot is never a slot
+        if (num >= freeSlot - 1)
+            throw std::length_error("ERROR: compact_list is limited to 2^32 - 2 elements");
+        if (num + 1 > capacity)
+            grow(static_cast<index>(num + 1));
+    }
+
+    /*********************************************
+     * COMPACT LIST :: GROW
+     * Move the slab to a bigger one. Slot numbers do not
+     * change, so neither do the links or the iterators.
+     *     INPUT  : how many slots the new slab holds
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the slots in use
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    void compact_list <T, A, Layout> ::grow(index newCapacity)
+    {
+        Node* newNodes = node_traits::allocate(alloc, newCapacity);
+        for (index i = 0; i < newCapacity; i++)
+            ::new (static_cast<void*>(newNodes + i)) Node;
+
+        // the payloads go where the layout wants them
+        Payload* newPayloads = nullptr;
+        if constexpr (split)
+        {
+            payload_allocator payloadAlloc(alloc);
+            try
+            {
+                newPayloads = payload_traits::allocate(payloadAlloc, newCapacity);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc, newNodes, newCapacity);
+                throw;
+            }
+        }
+
+        index i = 1;
+        try
+        {
+            for (; i < used; i++)
+                if (nodes[i].prev != freeSlot)
+                    ::new (static_cast<void*>(payload(newNodes, newPayloads, i).data)) T(std::move_if_noexcept(value(i)));
+        }
+        catch (...)
+        {
+            while (--i > 0)
+                if (nodes[i].prev != freeSlot)
+                    payload(newNodes, newPayloads, i).value().~T();
+            if constexpr (split)
+            {
+                payload_allocator payloadAlloc(alloc);
+                payload_traits::deallocate(payloadAlloc, newPayloads, newCapacity);
+            }
+            node_traits::deallocate(alloc, newNodes, newCapacity);
+            throw;
+        }
+
+        if (nodes)
+        {
+            for (i = 0; i < used; i++)
+            {
+                newNodes[i].next = nodes[i].next;
+                newNodes[i].prev = nodes[i].prev;
+                if (i > 0 && nodes[i].prev != freeSlot)
+                    value(i).~T();
+            }
+            release();
+        }
+        else
+        {
+            // the first slab starts with a sentinel pointing at itself
+            newNodes[0].next = newNodes[0].prev = 0;
+            used = 1;
+        }
+        nodes = newNodes;
+        if constexpr (split)
+            payloads = newPayloads;
+        capacity = newCapacity;
+    }
+
+    /*********************************************
+     * COMPACT LIST :: RELEASE
+     * Give the slabs back to the allocator. The elements
+     * have to be destroyed already.
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    void compact_list <T, A, Layout> ::release()
+    {
+        if (nodes == nullptr)
+            return;
+
+        if constexpr (split)
+        {
+            payload_allocator payloadAlloc(alloc);
+            payload_traits::deallocate(payloadAlloc, payloads, capacity);
+            payloads = nullptr;
+        }
+        node_traits::deallocate(alloc, nodes, capacity);
+        nodes = nullptr;
+    }
+
+    /*********************************************
+     * COMPACT LIST :: NEW SLOT
+     * Find an unused slot: a freed one first, then a fresh
+     * one, growing the slab by half again if it is full
+     *     INPUT  :
+     *     OUTPUT : an unlinked slot with no element in it
+     *     COST   : O(1) amortized
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    typename compact_list <T, A, Layout> ::index compact_list <T, A, Layout> ::newSlot()
+    {
+        if (freeHead)
+        {
+            index i = freeHead;
+            freeHead = nodes[i].next;
+            return i;
+        }
+
+        if (used == capacity)
+        {
+            size_t newCapacity = capacity < 16 ? 16 : size_t(capacity) + capacity / 2;
+            if (newCapacity >= freeSlot)
+                newCapacity = freeSlot - 1;
+            if (newCapacity <= used)
+                throw std::length_error("ERROR: compact_list is limited to 2^32 - 2 elements");
+            grow(static_cast<index>(newCapacity));
+        }
+        return used++;
+    }
+
+    /*********************************************
+     * COMPACT LIST :: EMPLACE
+     * Put a new element in front of the iterator. Growing
+     * the slab moves every element, and data may well be one
+     * of them, so when the slab is full the element is built
+     * off to the side before the slab grows.
+     *     INPUT  : where to put it and the value
+     *     OUTPUT : iterator to the new element
+     *     COST   : O(1) amortized
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    template <class U>
+    typename compact_list <T, A, Layout> ::iterator compact_list <T, A, Layout> ::emplace(iterator it, U&& data)
+    {
+        if (freeHead == 0 && used == capacity)
+        {
+            T value(std::forward<U>(data));
+            return place(it, newSlot(), std::move(value));
+        }
+        return place(it, newSlot(), std::forward<U>(data));
+    }
+
+    /*********************************************
+     * COMPACT LIST :: PLACE
+     * Build the element in an unused slot and link it in
+     * front of the iterator
+     *     INPUT  : where to put it, the slot and the value
+     *     OUTPUT : iterator to the new element
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    template <class U>
+    typename compact_list <T, A, Layout> ::iterator compact_list <T, A, Layout> ::place(iterator it, index i, U&& data)
+    {
+        try
+        {
+            ::new (static_cast<void*>(payload(i).data)) T(std::forward<U>(data));
+        }
+        catch (...)
+        {
+            nodes[i].prev = freeSlot;
+            nodes[i].next = freeHead;
+            freeHead = i;
+            throw;
+        }
+
+        index next = it.i;
+        index prev = nodes[next].prev;
+        nodes[i].next = next;
+        nodes[i].prev = prev;
+        nodes[prev].next = i;
+        nodes[next].prev = i;
+
+        numElements++;
+        return iterator(this, i);
+    }
+
+    /*********************************************
+     * COMPACT LIST :: ERASE
+     * Remove an element and put its slot on the free chain
+     *     INPUT  : iterator to the element
+     *     OUTPUT : iterator to the element after it
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    typename compact_list <T, A, Layout> ::iterator compact_list <T, A, Layout> ::erase(const iterator& it)
+    {
+        index i = it.i;
+        if (i == 0 || capacity == 0)
+            return end();
+
+        index next = nodes[i].next;
+        nodes[nodes[i].prev].next = next;
+        nodes[next].prev = nodes[i].prev;
+
+        value(i).~T();
+        nodes[i].prev = freeSlot;
+        nodes[i].next = freeHead;
+        freeHead = i;
+
+        numElements--;
+        return iterator(this, next);
+    }
+
+    /*********************************************
+     * COMPACT LIST :: CLEAR
+     * Destroy every element. The slab is kept.
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of nodes
+     *********************************************/
+    template <typename T, typename A, typename Layout>
+    void compact_list <T, A, Layout> ::clear()
+    {
+        if (capacity == 0)
+            return;
+
+        for (index i = nodes[0].next; i != 0; i = nodes[i].next)
+            value(i).~T();
+
+        nodes[0].next = nodes[0].prev = 0;
+        used = 1;
+        freeHead = 0;
+        numElements = 0;
+    }
+
+}; // namespace custom
@@ -0,0 +1,315 @@
+/***********************************************************************
+ * Header:
+ *    INTRUSIVE LIST
+ * Summary:
+ *    A list that does not own its elements. Each element carries
+ *    its own links in a hook member, so linking and unlinking
+ *    never allocates and an element can erase itself in O(1).
+ *
+ *    This will contain the class definition of:
+ *        list_hook             : the links embedded in an element
+ *        auto_unlink_hook      : a hook that unlinks itself when destroyed
+ *        intrusive_list        : a list threaded through the hooks
+ *        intrusive_list::iterator : an iterator through the list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstddef>     // for size_t
+#include <type_traits> // for std::is_base_of
+#include <utility>     // for std::declval
+
+namespace custom
+{
+    template <class T, auto Hook>
+    class intrusive_list;
+
+    /**************************************************
+     * LIST HOOK
+     * Embed one of these in an element to let it sit in an
+     * intrusive_list. An unlinked hook has null pointers.
+     **************************************************/
+    class list_hook
+    {
+    public:
+        list_hook() : pNext(nullptr), pPrev(nullptr) { }
+
+        // copying an element does not copy its place in a list
+        list_hook(const list_hook&) : pNext(nullptr), pPrev(nullptr) { }
+        list_hook& operator = (const list_hook&) { return *this; }
+
+        bool is_linked() const { return pNext != nullptr; }
+
+        // take this hook out of whatever list it is in
+        void unlink()
+        {
+            if (is_linked())
+            {
+                pPrev->pNext = pNext;
+                pNext->pPrev = pPrev;
+                pNext = pPrev = nullptr;
+            }
+        }
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        template <class T, auto Hook>
+        friend class intrusive_list;
+
+        list_hook* pNext;   // next hook, or the list's sentinel
+        list_hook* pPrev;   // previous hook, or the list's sentinel
+    };
+
+    /**************************************************
+     * AUTO UNLINK HOOK
+     * A hook that leaves its list when the element is
+     * destroyed. Lists of these cannot keep a count, so
+     * their size() walks the list.
+     **************************************************/
+    class auto_unlink_hook : public list_hook
+    {
+    public:
+        ~auto_unlink_hook() { unlink(); }
+    };
+
+    /**************************************************
+     * INTRUSIVE LIST
+     * Just like custom::list, but the elements are owned by
+     * the caller and linked through the hook member Hook,
+     * as in intrusive_list<Task, &Task::hook>
+     **************************************************/
+    template <class T, auto Hook>
+    class intrusive_list
+    {
+    public:
+        //
+        // Construct
+        //
+
+        intrusive_list() : numElements(0) { sentinel.pNext = sentinel.pPrev = &sentinel; }
+        intrusive_list(intrusive_list&& rhs);
+        intrusive_list(const intrusive_list&) = delete;
+        intrusive_list& operator = (const intrusive_list&) = delete;
+        ~intrusive_list() { clear(); }
+
+        //
+        // Iterator
+        //
+
+        class iterator;
+        iterator begin() { return iterator(sentinel.pNext); }
+        iterator end() { return iterator(&sentinel); }
+        iterator iterator_to(T& t) { return iterator(&hook(t)); }
+
+        //
+        // Access
+        //
+
+        T& front() { assert(!empty()); return element(sentinel.pNext); }
+        T& back() { assert(!empty()); return element(sentinel.pPrev); }
+
+        //
+        // Insert
+        //
+
+        void push_front(T& t) { insert(begin(), t); }
+        void push_back(T& t) { insert(end(), t); }
+        iterator insert(iterator it, T& t);
+
+        //
+        // Remove
+        //
+
+        void pop_front() { if (!empty()) erase(begin()); }
+        void pop_back() { if (!empty()) erase(iterator(sentinel.pPrev)); }
+        void clear();
+        iterator erase(iterator it);
+        iterator erase(T& t) { return erase(iterator_to(t)); }
+
+        //
+        // Status
+        //
+
+        bool empty() const { return sentinel.pNext == &sentinel; }
+        size_t size() const;
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        // the type of the hook member, which tells us whether we can count
+        using hook_type = std::remove_reference_t<decltype(std::declval<T&>().*Hook)>;
+        static const bool autoUnlink = std::is_base_of<auto_unlink_hook, hook_type>::value;
+
+        // get from an element to its hook and back again
+        static list_hook& hook(T& t) { return t.*Hook; }
+        static T& element(list_hook* p);
+
+        // member variables
+        list_hook sentinel;   // before the first and after the last element
+        size_t numElements;   // not kept for auto-unlink hooks, they leave without telling us
+    };
+
+    /*************************************************
+     * INTRUSIVE LIST ITERATOR
+     * Iterate through an intrusive list
+     ************************************************/
+    template <class T, auto Hook>
+    class intrusive_list <T, Hook> ::iterator
+    {
+    public:
+        iterator() : p(nullptr) { }
+        iterator(list_hook* p) : p(p) { }
+
+        bool operator != (const iterator& rhs) const { return rhs.p != p; }
+        bool operator == (const iterator& rhs) const { return rhs.p == p; }
+
+        T& operator * () { return element(p); }
+        T* operator -> () { return &element(p); }
+
+        iterator& operator ++ () { p = p->pNext; return *this; }
+        iterator operator ++ (int postfix) { iterator it(*this); p = p->pNext; return it; }
+        iterator& operator -- () { p = p->pPrev; return *this; }
+        iterator operator -- (int postfix) { iterator it(*this); p = p->pPrev; return it; }
+
+        friend class intrusive_list <T, Hook>;
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        list_hook* p;
+    };
+
+    /*****************************************
+     * INTRUSIVE LIST :: MOVE constructor
+     * Take over the elements of the RHS. The end elements
+     * point at the sentinel, so they have to be re-pointed
+     ****************************************/
+    template <class T, auto Hook>
+    intrusive_list <T, Hook> ::intrusive_list(intrusive_list&& rhs) : numElements(rhs.numElements)
+    {
+        if (rhs.empty())
+        {
+            sentinel.pNext = sentinel.pPrev = &sentinel;
+            return;
+        }
+
+        sentinel.pNext = rhs.sentinel.pNext;
+        sentinel.pPrev = rhs.sentinel.pPrev;
+        sentinel.pNext->pPrev = &sentinel;
+        sentinel.pPrev->pNext = &sentinel;
+
+        rhs.sentinel.pNext = rhs.sentinel.pPrev = &rhs.sentinel;
+        rhs.numElements = 0;
+    }
+
+    /*********************************************
+     * INTRUSIVE LIST :: ELEMENT
+     * The element that holds a given hook
+     *     INPUT  : a hook inside an element
+     *     OUTPUT : the element
+     *     COST   : O(1)
+     *********************************************/
+    template <class T, auto Hook>
+    T& intrusive_list <T, Hook> ::element(list_hook* p)
+    {
+        // the hook sits at a fixed offset inside every T, measured
+        // against real, suitably aligned storage for a T
+        alignas(T) static unsigned char layout[sizeof(T)];
+        const size_t offset = static_cast<size_t>(
+            reinterpret_cast<unsigned char*>(&(reinterpret_cast<T*>(layout)->*Hook)) - layout);
+        return *reinterpret_cast<T*>(reinterpret_cast<char*>(p) - offset);
+    }
+
+    /*********************************************
+     * INTRUSIVE LIST :: INSERT
+     * Link an element in front of the iterator
+     *     INPUT  : where to put the element
+     *              an element that is not in any list
+     *     OUTPUT : iterator to the element
+     *     COST   : O(1)
+     *********************************************/
+    template <class T, auto Hook>
+    typename intrusive_list <T, Hook> ::iterator intrusive_list <T, Hook> ::insert(iterator it, T& t)
+    {
+        list_hook* pNew = &hook(t);
+        assert(!pNew->is_linked());
+
+        pNew->pNext = it.p;
+        pNew->pPrev = it.p->pPrev;
+        it.p->pPrev->pNext = pNew;
+        it.p->pPrev = pNew;
+
+        numElements++;
+        return iterator(pNew);
+    }
+
+    /*********************************************
+     * INTRUSIVE LIST :: ERASE
+     * Unlink an element. The element itself is untouched.
+     *     INPUT  : iterator to the element
+     *     OUTPUT : iterator to the element after it
+     *     COST   : O(1)
+     *********************************************/
+    template <class T, auto Hook>
+    typename intrusive_list <T, Hook> ::iterator intrusive_list <T, Hook> ::erase(iterator it)
+    {
+        assert(it.p != &sentinel);
+        iterator itNext(it.p->pNext);
+        it.p->unlink();
+        numElements--;
+        return itNext;
+    }
+
+    /*********************************************
+     * INTRUSIVE LIST :: CLEAR
+     * Unlink every element, leaving them free to join
+     * another list
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of elements
+     *********************************************/
+    template <class T, auto Hook>
+    void intrusive_list <T, Hook> ::clear()
+    {
+        list_hook* p = sentinel.pNext;
+        while (p != &sentinel)
+        {
+            list_hook* pNext = p->pNext;
+            p->pNext = p->pPrev = nullptr;
+            p = pNext;
+        }
+        sentinel.pNext = sentinel.pPrev = &sentinel;
+        numElements = 0;
+    }
+
+    /*********************************************
+     * INTRUSIVE LIST :: SIZE
+     * How many elements are linked in
+     *     INPUT  :
+     *     OUTPUT : the number of elements
+     *     COST   : O(1), or O(n) for auto-unlink hooks
+     *********************************************/
+    template <class T, auto Hook>
+    size_t intrusive_list <T, Hook> ::size() const
+    {
+        if constexpr (autoUnlink)
+        {
+            size_t num = 0;
+            for (const list_hook* p = sentinel.pNext; p != &sentinel; p = p->pNext)
+                num++;
+            return num;
+        }
+        else
+            return numElements;
+    }
+
+}; // namespace custom
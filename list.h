@@ -23,48 +23,518 @@
 #include <iostream>    // for nullptr
 #include <new>         // std::bad_alloc
 #include <memory>      // for std::allocator
+#include <vector>      // for the registry of node blocks
+#include <algorithm>   // for std::upper_bound
+#include <iterator>    // for std::distance
+#include <functional>  // for std::less
+#include <mutex>       // for the node depot
+#include <memory_resource> // for std::pmr::polymorphic_allocator
+#include <utility>     // for std::forward and std::in_place
+#include <thread>      // for parallel_sort
+#include <exception>   // for std::exception_ptr
+#include <type_traits> // for std::make_unsigned
+#include <unordered_map> // for the positional index
+#include <stdexcept>   // for std::out_of_range
 
 namespace custom
 {
 
+    /**************************************************
+     * NODE CACHE
+     * Spare node storage shared by every list of one node
+     * type on a thread. Each thread keeps up to threadLimit
+     * nodes and trades the surplus with a process-wide depot
+     * in batches, so warmed-up lists never touch the allocator.
+     * Only usable with allocators whose instances are all equal.
+     * Once this thread's cache or the depot has been torn down at
+     * exit, get() finds nothing and put() declines, so lists that
+     * outlive them go straight to the allocator.
+     **************************************************/
+    template <class Alloc>
+    class node_cache
+    {
+    public:
+        using value_type = typename std::allocator_traits<Alloc>::value_type;
+
+        static const size_t threadLimit = 256;      // spare nodes held by one thread
+        static const size_t batch = 64;             // nodes moved to or from the depot at once
+        static const size_t depotLimit = 64 * 1024; // spare nodes held by the whole process
+
+        // storage for one node, or nullptr if there is none spare
+        static value_type* get()
+        {
+            Local* pLocal = Local::instance();
+            if (pLocal == nullptr)
+                return nullptr;
+            if (pLocal->pHead == nullptr)
+                pLocal->refill();
+            if (pLocal->pHead == nullptr)
+                return nullptr;
+
+            Link* p = pLocal->pHead;
+            pLocal->pHead = p->pNext;
+            pLocal->count--;
+            return reinterpret_cast<value_type*>(p);
+        }
+
+        // take back storage of a node that has already been destroyed,
+        // or return false if the cache is gone and the caller must free it
+        static bool put(value_type* p)
+        {
+            Local* pLocal = Local::instance();
+            if (pLocal == nullptr)
+                return false;
+            pLocal->pHead = ::new (static_cast<void*>(p)) Link{ pLocal->pHead };
+            if (++pLocal->count > threadLimit)
+                pLocal->spill(batch);
+            return true;
+        }
+
+        // how many spare nodes this thread is holding
+        static size_t size()
+        {
+            Local* pLocal = Local::instance();
+            return pLocal ? pLocal->count : 0;
+        }
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        // spare storage is threaded through the nodes themselves
+        struct Link
+        {
+            Link* pNext;
+        };
+
+        // give a chain of spare nodes back to the allocator
+        static void freeChain(Link* p)
+        {
+            Alloc alloc;
+            while (p)
+            {
+                Link* pDelete = p;
+                p = p->pNext;
+                std::allocator_traits<Alloc>::deallocate(alloc, reinterpret_cast<value_type*>(pDelete), 1);
+            }
+        }
+
+        // what every thread hands its surplus to
+        struct Depot
+        {
+            std::mutex mutex;
+            Link* pHead = nullptr;
+            size_t count = 0;
+
+            // set for good once the depot is destroyed at exit; a plain
+            // flag, so it can still be read after that
+            inline static bool tornDown = false;
+
+            ~Depot()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                freeChain(pHead);
+                pHead = nullptr;
+                count = 0;
+                tornDown = true;
+            }
+            static Depot& instance()
+            {
+                static Depot depot;
+                return depot;
+            }
+        };
+
+        // what this thread draws from first
+        struct Local
+        {
+            Link* pHead = nullptr;
+            size_t count = 0;
+
+            // set once this thread's cache is destroyed, so a list
+            // destroyed after it does not touch the dead object
+            inline static thread_local bool tornDown = false;
+
+            // the depot must outlive us, so make sure it exists first
+            Local() { Depot::instance(); }
+            ~Local()
+            {
+                spill(count);
+                tornDown = true;
+            }
+
+            // this thread's cache, or nullptr once it has been destroyed
+            static Local* instance()
+            {
+                if (tornDown)
+                    return nullptr;
+                thread_local Local local;
+                return &local;
+            }
+
+            // move num nodes to the depot, or free them if it is full or gone
+            void spill(size_t num)
+            {
+                if (num == 0)
+                    return;
+                Link* pFirst = pHead;
+                Link* pLast = pHead;
+                for (size_t i = 1; i < num; i++)
+                    pLast = pLast->pNext;
+                pHead = pLast->pNext;
+                count -= num;
+
+                if (!Depot::tornDown)
+                {
+                    Depot& depot = Depot::instance();
+                    std::lock_guard<std::mutex> lock(depot.mutex);
+                    if (depot.count + num <= depotLimit)
+                    {
+                        pLast->pNext = depot.pHead;
+                        depot.pHead = pFirst;
+                        depot.count += num;
+                        return;
+                    }
+                }
+                pLast->pNext = nullptr;
+                freeChain(pFirst);
+            }
+
+            // take up to a batch of nodes from the depot
+            void refill()
+            {
+                if (Depot::tornDown)
+                    return;
+                Depot& depot = Depot::instance();
+                std::lock_guard<std::mutex> lock(depot.mutex);
+                while (depot.pHead && count < batch)
+                {
+                    Link* p = depot.pHead;
+                    depot.pHead = p->pNext;
+                    depot.count--;
+                    p->pNext = pHead;
+                    pHead = p;
+                    count++;
+                }
+            }
+        };
+    };
+
+    /**************************************************
+     * USES NODE CACHE
+     * Whether lists over the allocator Alloc trade spare nodes
+     * through the node cache instead of freeing them. Only
+     * std::allocator does out of the box. Another allocator
+     * opts in by specializing this to true, which is only sound
+     * if it is always-equal and default-constructible, since
+     * any instance must be able to free any node.
+     **************************************************/
+    template <class Alloc>
+    struct uses_node_cache : std::false_type { };
+    template <class T>
+    struct uses_node_cache <std::allocator<T>> : std::true_type { };
+
+    /**************************************************
+     * POSITION INDEX
+     * An order-statistics tree over the nodes of one list,
+     * kept beside the list rather than in the nodes so that
+     * a list without one pays nothing in its node layout.
+     * The tree is a treap: in order it follows the list, and
+     * random priorities keep it balanced. Each entry counts
+     * the entries under it, so a position is found in
+     * O(log n) either way. Entries are found from their node
+     * through a hash map, which also owns them.
+     **************************************************/
+    template <class Link, class Alloc>
+    class position_index
+    {
+    public:
+        explicit position_index(const Alloc& a) : entries(entry_allocator(a)), pRoot(nullptr), seed(0x9E3779B97F4A7C15ULL) { }
+        position_index(const position_index&) = delete;
+        position_index& operator = (const position_index&) = delete;
+
+        size_t size() const { return count(pRoot); }
+
+        // put p in front of pPos, which is at the end if it is not in the index
+        void insert(const Link* p, const Link* pPos)
+        {
+            Entry& e = entries.emplace(p, Entry{ p, nullptr, nullptr, nullptr, 1, nextPriority() }).first->second;
+            place(&e, find(pPos));
+        }
+
+        // take p out of the index, if it is there at all
+        void erase(const Link* p)
+        {
+            auto it = entries.find(p);
+            if (it == entries.end())
+                return;
+            detach(&it->second);
+            entries.erase(it);
+        }
+
+        // take p out of the tree and put it back in front of pPos
+        void move(const Link* p, const Link* pPos)
+        {
+            Entry* pEntry = find(p);
+            detach(pEntry);
+            place(pEntry, find(pPos));
+        }
+
+        void clear()
+        {
+            entries.clear();
+            pRoot = nullptr;
+        }
+
+        // the node at position i, which must be in range
+        const Link* at(size_t i) const
+        {
+            const Entry* pEntry = pRoot;
+            for (;;)
+            {
+                size_t left = count(pEntry->pLeft);
+                if (i == left)
+                    return pEntry->pNode;
+                if (i < left)
+                    pEntry = pEntry->pLeft;
+                else
+                {
+                    i -= left + 1;
+                    pEntry = pEntry->pRight;
+                }
+            }
+        }
+
+        // the position of p, or size() if it is not in the index
+        size_t index_of(const Link* p) const
+        {
+            auto it = entries.find(p);
+            if (it == entries.end())
+                return size();
+
+            const Entry* pEntry = &it->second;
+            size_t i = count(pEntry->pLeft);
+            for (; pEntry->pParent; pEntry = pEntry->pParent)
+                if (pEntry->pParent->pRight == pEntry)
+                    i += count(pEntry->pParent->pLeft) + 1;
+            return i;
+        }
+
+        // after the list has been reordered, shape the tree to match it.
+        // Every node from pFirst up to pEnd must already have an entry.
+        void rebuild(const Link* pFirst, const Link* pEnd)
+        {
+            // the right spine of the tree so far is a stack, kept
+            // in order of priority, that each new entry cuts into
+            pRoot = nullptr;
+            Entry* pRightmost = nullptr;
+            for (const Link* p = pFirst; p != pEnd; p = p->pNext)
+            {
+                Entry* pEntry = find(p);
+                Entry* pChild = nullptr;
+                Entry* pSpine = pRightmost;
+                while (pSpine && pSpine->priority < pEntry->priority)
+                {
+                    pSpine->size = 1 + count(pSpine->pLeft) + count(pSpine->pRight);
+                    pChild = pSpine;
+                    pSpine = pSpine->pParent;
+                }
+
+                pEntry->pLeft = pChild;
+                pEntry->pRight = nullptr;
+                pEntry->pParent = pSpine;
+                if (pChild)
+                    pChild->pParent = pEntry;
+                if (pSpine)
+                    pSpine->pRight = pEntry;
+                else
+                    pRoot = pEntry;
+                pRightmost = pEntry;
+            }
+
+            for (Entry* pSpine = pRightmost; pSpine; pSpine = pSpine->pParent)
+                pSpine->size = 1 + count(pSpine->pLeft) + count(pSpine->pRight);
+        }
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        struct Entry
+        {
+            const Link* pNode; // the node this entry stands for
+            Entry* pLeft;
+            Entry* pRight;
+            Entry* pParent;
+            size_t size;       // how many entries in the subtree rooted here
+            size_t priority;   // no child has a higher priority than its parent
+        };
+        using entry_allocator = typename std::allocator_traits<Alloc>::template
+            rebind_alloc<std::pair<const Link* const, Entry>>;
+        using entry_map = std::unordered_map<const Link*, Entry, std::hash<const Link*>,
+            std::equal_to<const Link*>, entry_allocator>;
+
+        static size_t count(const Entry* pEntry) { return pEntry ? pEntry->size : 0; }
+
+        Entry* find(const Link* p)
+        {
+            auto it = entries.find(p);
+            return it == entries.end() ? nullptr : &it->second;
+        }
+
+        // xorshift, so that the shape of the tree does not depend on the data
+        size_t nextPriority()
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            return static_cast<size_t>(seed);
+        }
+
+        // lift pEntry above its parent, keeping the order and the counts
+        void rotateUp(Entry* pEntry)
+        {
+            Entry* pParent = pEntry->pParent;
+            Entry* pGrand = pParent->pParent;
+            if (pParent->pLeft == pEntry)
+            {
+                pParent->pLeft = pEntry->pRight;
+                if (pEntry->pRight)
+                    pEntry->pRight->pParent = pParent;
+                pEntry->pRight = pParent;
+            }
+            else
+            {
+                pParent->pRight = pEntry->pLeft;
+                if (pEntry->pLeft)
+                    pEntry->pLeft->pParent = pParent;
+                pEntry->pLeft = pParent;
+            }
+            pParent->pParent = pEntry;
+            pEntry->pParent = pGrand;
+            if (!pGrand)
+                pRoot = pEntry;
+            else if (pGrand->pLeft == pParent)
+                pGrand->pLeft = pEntry;
+            else
+                pGrand->pRight = pEntry;
+
+            pEntry->size = pParent->size;
+            pParent->size = 1 + count(pParent->pLeft) + count(pParent->pRight);
+        }
+
+        // hang a lone entry in front of pPos, or at the end, then
+        // lift it until its parent outranks it
+        void place(Entry* pEntry, Entry* pPos)
+        {
+            pEntry->pLeft = pEntry->pRight = nullptr;
+            pEntry->size = 1;
+
+            Entry* pParent = pPos ? pPos->pLeft : pRoot;
+            bool left = pPos && !pParent;
+            if (left)
+                pParent = pPos;
+            else if (pParent)
+                while (pParent->pRight)
+                    pParent = pParent->pRight;
+
+            pEntry->pParent = pParent;
+            if (!pParent)
+                pRoot = pEntry;
+            else if (left)
+                pParent->pLeft = pEntry;
+            else
+                pParent->pRight = pEntry;
+
+            for (Entry* p = pParent; p; p = p->pParent)
+                p->size++;
+            while (pEntry->pParent && pEntry->pParent->priority < pEntry->priority)
+                rotateUp(pEntry);
+        }
+
+        // push an entry down until it is a leaf, then cut it off
+        void detach(Entry* pEntry)
+        {
+            while (pEntry->pLeft || pEntry->pRight)
+            {
+                Entry* pChild = pEntry->pLeft;
+                if (!pChild || (pEntry->pRight && pEntry->pRight->priority > pChild->priority))
+                    pChild = pEntry->pRight;
+                rotateUp(pChild);
+            }
+
+            Entry* pParent = pEntry->pParent;
+            if (!pParent)
+                pRoot = nullptr;
+            else if (pParent->pLeft == pEntry)
+                pParent->pLeft = nullptr;
+            else
+                pParent->pRight = nullptr;
+            for (Entry* p = pParent; p; p = p->pParent)
+                p->size--;
+            pEntry->pParent = nullptr;
+        }
+
+        entry_map entries;   // every entry, found by its node
+        Entry* pRoot;        // the top of the tree, nullptr when empty
+        unsigned long long seed; // where the next priority comes from
+    };
+
     /**************************************************
      * LIST
-     * Just like std::list
+     * Just like std::list. Every node is obtained through
+     * the allocator A, rebound to our Node type. Lone nodes
+     * a list frees go to the thread's node cache instead of
+     * back to A when uses_node_cache<A> says so, which by
+     * default is only for std::allocator. The nodes
+     * form a ring through a sentinel that end() refers to,
+     * so no link is ever null and nothing has to special
+     * case the head or the tail.
      **************************************************/
-    template <typename T>
+    template <typename T, typename A = std::allocator<T>>
     class list
     {
     public:
+        using allocator_type = A;
+
         //
         // Construct
         //
 
         list();
-        list(list <T>& rhs);
-        list(list <T>&& rhs);
-        list(size_t num, const T& t);
-        list(size_t num);
-        list(const std::initializer_list<T>& il);
+        explicit list(const A& a);
+        list(list <T, A>& rhs);
+        list(list <T, A>&& rhs) noexcept;
+        list(size_t num, const T& t, const A& a = A());
+        list(size_t num, const A& a = A());
+        list(const std::initializer_list<T>& il, const A& a = A());
         template <class Iterator>
-        list(Iterator first, Iterator last);
-        ~list() { clear(); }
+        list(Iterator first, Iterator last, const A& a = A());
+        ~list() { clear(); dropIndex(); release_cached_nodes(); releaseBlocks(); }
 
         //
         // Assign
         //
 
-        list <T>& operator = (list& rhs);
-        list <T>& operator = (list&& rhs);
-        list <T>& operator = (const std::initializer_list<T>& il);
+        list <T, A>& operator = (list& rhs);
+        list <T, A>& operator = (list&& rhs)
+            noexcept(std::allocator_traits<A>::propagate_on_container_move_assignment::value ||
+                     std::allocator_traits<A>::is_always_equal::value);
+        list <T, A>& operator = (const std::initializer_list<T>& il);
+        void swap(list& rhs) noexcept;
 
         //
         // Iterator
         //
 
         class iterator;
-        iterator begin() { return iterator(pHead); }
-        iterator rbegin() { return iterator(); }
-        iterator end() { return iterator(nullptr); }
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        iterator begin() { return iterator(sentinel.pNext); }
+        iterator end() { return iterator(&sentinel); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
 
         //
         // Access
@@ -83,6 +553,18 @@ namespace custom
         void push_back(T&& data);
         iterator insert(iterator it, const T& data);
         iterator insert(iterator it, T&& data);
+        iterator insert(iterator it, size_t num, const T& t);
+        iterator insert(iterator it, const std::initializer_list<T>& il);
+        template <class Iterator, class = std::enable_if_t<!std::is_integral<Iterator>::value>>
+        iterator insert(iterator it, Iterator first, Iterator last);
+
+        // build the element inside its node from the arguments
+        template <class ... Args>
+        T& emplace_front(Args&& ... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+        template <class ... Args>
+        T& emplace_back(Args&& ... args) { return *emplace(end(), std::forward<Args>(args)...); }
+        template <class ... Args>
+        iterator emplace(iterator it, Args&& ... args);
 
         //
         // Remove
@@ -92,6 +574,47 @@ namespace custom
         void pop_front();
         void clear();
         iterator erase(const iterator& it);
+        iterator erase(const iterator& first, const iterator& last);
+
+        // drop every match in one pass, returning how many went
+        size_t remove(const T& t) { return remove_if([&t](const T& data) { return data == t; }); }
+        template <class Predicate>
+        size_t remove_if(Predicate pred);
+        size_t unique() { return unique(std::equal_to<T>()); }
+        template <class BinaryPredicate>
+        size_t unique(BinaryPredicate pred);
+
+        //
+        // Operations - these relink nodes, they never copy or allocate
+        //
+
+        void sort() { sort(std::less<T>()); }
+        template <class Compare>
+        void sort(Compare comp);
+        template <class Compare>
+        void parallel_sort(Compare comp, size_t numThreads = 0);
+        void radix_sort() { radix_sort([](const T& t) { return t; }); }
+        template <class KeyFn>
+        void radix_sort(KeyFn key);
+
+        void reverse();
+
+        // move nodes from another list, or within this one, in front of it
+        void splice(iterator it, list& rhs);
+        void splice(iterator it, list&& rhs) { splice(it, rhs); }
+        void splice(iterator it, list& rhs, iterator itRHS);
+        void splice(iterator it, list&& rhs, iterator itRHS) { splice(it, rhs, itRHS); }
+        void splice(iterator it, list& rhs, iterator first, iterator last);
+        void splice(iterator it, list&& rhs, iterator first, iterator last) { splice(it, rhs, first, last); }
+        void splice(iterator it, list& rhs, iterator first, iterator last, size_t num);
+
+        // interleave the nodes of another sorted list
+        void merge(list& rhs) { merge(rhs, std::less<T>()); }
+        void merge(list&& rhs) { merge(rhs, std::less<T>()); }
+        template <class Compare>
+        void merge(list& rhs, Compare comp);
+        template <class Compare>
+        void merge(list&& rhs, Compare comp) { merge(rhs, comp); }
 
         //
         // Status - Finished
@@ -99,6 +622,31 @@ namespace custom
 
         bool empty()  const { return size() == 0; }
         size_t size() const { return numElements; }
+        allocator_type get_allocator() const { return allocator_type(alloc); }
+
+        //
+        // Node recycling - off until a high-water mark is set
+        //
+
+        void set_node_recycling(size_t highWater);
+        size_t cached_nodes() const { return numFree; }
+        void release_cached_nodes();
+
+        // move the nodes into fresh contiguous storage in list order,
+        // all at once or num at a time from it, returning where to resume
+        void compact() { compact(begin(), numElements); }
+        iterator compact(iterator it, size_t num);
+
+        //
+        // Positional access - walks the list, or O(log n) once the index is on
+        //
+
+        void set_positional_index(bool on);
+        bool has_positional_index() const { return pIndex != nullptr; }
+        T& at(size_t i);
+        iterator iterator_at(size_t i);
+        size_t index_of(const iterator& it) const;
+        void advance(iterator& it, ptrdiff_t num);
 
 
 #ifdef DEBUG // make this visible to the unit tests
@@ -109,10 +657,106 @@ namespace custom
         // nested linked list class
         class Node;
 
+        // the links every node carries, and all the sentinel has. The
+        // sentinel sits between the tail and the head and has no T, so
+        // only a link known to be some other one may be taken as a Node
+        struct Link
+        {
+            Link* pNext;       // pointer to next node, or the sentinel
+            Link* pPrev;       // pointer to previous node, or the sentinel
+
+            Node* node() { return static_cast<Node*>(this); }
+            const Node* node() const { return static_cast<const Node*>(this); }
+        };
+        void relinkSentinel();
+
+        // sorting works on null-terminated runs linked through pNext only
+        template <class Compare>
+        static void sortRun(Link*& pRun, Compare& comp);
+        template <class Compare>
+        static void mergeRuns(Link*& pRun, Link* pLater, Compare& comp);
+        static Link* joinRuns(Link** pRuns, size_t num);
+        void adoptChain(Link* pFirst);
+
+        // splicing moves [pFirst, pLast) in front of pPos, and any nodes
+        // that came from the blocks of rhs take those blocks with them
+        static void transfer(Link* pPos, Link* pFirst, Link* pLast);
+        void adoptBlocks(const list& rhs);
+        void indexSplice(Link* pPos, list& rhs, Link* pFirst, Link* pLast);
+
+        // a parallel sort hands each thread at least this many nodes
+        static const size_t parallelGrain = 16 * 1024;
+
+        // a radix sort deals the nodes out on one byte of the key per pass
+        static const size_t radixBuckets = 256;
+
+        // the allocator A rebound to hand out nodes instead of T
+        using node_allocator = typename std::allocator_traits<A>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+        // a run of nodes carved from one allocation by the bulk
+        // constructors or by compact
+        struct Block
+        {
+            Node* pNodes;    // the first node, where the block sorts in a registry
+            size_t capacity; // how many nodes the allocation holds
+            size_t used;     // how many of them have been handed out so far
+            size_t live;     // how many have not been given back yet, 0 once the storage is freed
+            size_t owners;   // how many lists may still hold nodes from it
+        };
+        using block_allocator = typename std::allocator_traits<A>::template rebind_alloc<Block>;
+        using block_traits = std::allocator_traits<block_allocator>;
+        using block_registry = std::vector<Block*,
+            typename std::allocator_traits<A>::template rebind_alloc<Block*>>;
+
+        // lone nodes are traded between lists only when A opts in,
+        // and only then if any allocator can free them
+        static const bool threadCached = uses_node_cache<A>::value &&
+                                         node_traits::is_always_equal::value &&
+                                         std::is_default_constructible<node_allocator>::value;
+
+        // every node is created and destroyed through these two
+        template <class ... Args>
+        Node* allocateNode(Args&& ... args);
+        void deleteNode(Node* p);
+        size_t deleteChain(Link* pFirst);
+
+        // build num nodes off to the side, then link them all in front of it
+        template <class Generator>
+        iterator insertChain(iterator it, size_t num, Generator next);
+
+        // node storage, either a lone allocation or a slot in a block
+        template <class Generator>
+        void constructBlock(size_t num, Generator next);
+        Node* newStorage();
+        void freeStorage(Node* p);
+        void releaseBlocks();
+        Link* relocate(Link* pFirst, size_t num);
+
+        // the registry is kept in order of address, so the block a node
+        // came from is found by a binary search
+        typename block_registry::iterator findBlock(const Node* p);
+        void addBlock(Block* pBlock);
+        bool returnToBlock(Node* p);
+
+        // the optional positional index, which has to hear of every node
+        // that joins or leaves the list, or of any change to their order
+        using index_type = position_index<Link, A>;
+        using index_allocator = typename std::allocator_traits<A>::template rebind_alloc<index_type>;
+        using index_traits = std::allocator_traits<index_allocator>;
+        void dropIndex();
+        void reindex();
+
         // member variables
         size_t numElements; // though we could count, it is faster to keep a variable
-        Node* pHead;    // pointer to the beginning of the list
-        Node* pTail;    // pointer to the ending of the list
+        Link sentinel;  // pNext is the head and pPrev the tail, both itself when empty
+        node_allocator alloc; // where the nodes come from
+        Node* pFree;    // erased nodes waiting to be reused, linked through their storage
+        size_t numFree; // how many nodes are sitting in pFree
+        size_t maxFree; // never cache more than this many, zero for no recycling
+        block_registry blocks; // the blocks our nodes may have come from, by address
+        Block* pFill;          // the block compact is moving nodes into, if any
+        index_type* pIndex;    // positions of our nodes, nullptr unless asked for
     };
 
     /*************************************************
@@ -122,36 +766,44 @@ namespace custom
      * private.  This is the case because only the
      * List class can make validation decisions
      *************************************************/
-    template <typename T>
-    class list <T> ::Node
+    template <typename T, typename A>
+    class list <T, A> ::Node : public list <T, A> ::Link
     {
     public:
         //
         // Construct
         //
-        Node() : pNext(nullptr), pPrev(nullptr), data() { } // Default constructor
-        Node(const T& data) : pNext(nullptr), pPrev(nullptr), data(data) { } // Copy Constructor
-        Node(T&& data) : pNext(nullptr), pPrev(nullptr), data(std::move(data)) { } // Move Constructor
+        Node() : Link{ nullptr, nullptr }, data() { } // Default constructor
+        Node(const T& data) : Link{ nullptr, nullptr }, data(data) { } // Copy Constructor
+        Node(T&& data) : Link{ nullptr, nullptr }, data(std::move(data)) { } // Move Constructor
+        template <class ... Args>
+        Node(std::in_place_t, Args&& ... args) :          // Build the data from any arguments
+            Link{ nullptr, nullptr }, data(std::forward<Args>(args)...) { }
 
        //
        // Data
        //
 
-        T data;                 // user data 
-        Node* pNext;       // pointer to next node
-        Node* pPrev;       // pointer to previous node
+        T data;                 // user data, after the links inherited from Link
     };
 
     /*************************************************
      * LIST ITERATOR - Finished
      * Iterate through a List, non-constant version
      ************************************************/
-    template <typename T>
-    class list <T> ::iterator
+    template <typename T, typename A>
+    class list <T, A> ::iterator
     {
     public:
+        // what std::reverse_iterator and the algorithms need to know
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
         iterator() { p = nullptr; }
-        iterator(Node* pRHS) { p = pRHS; }
+        iterator(Link* pRHS) { p = pRHS; }
         iterator(const iterator& rhs) { p = rhs.p; }
         iterator& operator = (const iterator& rhs)
         {
@@ -164,63 +816,46 @@ namespace custom
         bool operator == (const iterator& rhs) const { return (rhs.p == p ? true : false); }
 
         // dereference operator, fetch a node
-        T& operator * ()
+        T& operator * () const
+        {
+            return p->node()->data;
+        }
+        T* operator -> () const
         {
-            return p->data;
+            return &p->node()->data;
         }
 
         // postfix increment
         iterator operator ++ (int postfix)
         {
-            if (p->pNext) {
-                p = p->pNext;
-                return p;
-            }
-            p = nullptr;
-            return p;
+            iterator it(*this);
+            p = p->pNext;
+            return it;
         }
 
-        // prefix increment
+        // prefix increment, the sentinel follows the tail
         iterator& operator ++ ()
         {
-            iterator it = p;
-            if (p->pNext) {
-                p = p->pNext;
-                return it;
-            }
-            p = nullptr;
+            p = p->pNext;
             return *this;
         }
 
         // postfix decrement
         iterator operator -- (int postfix)
         {
-            if (p->pPrev) {
-                p = p->pPrev;
-                return p;
-            }
-            p = nullptr;
-            return p;
+            iterator it(*this);
+            p = p->pPrev;
+            return it;
         }
 
-        // prefix decrement
+        // prefix decrement, so --end() is the tail
         iterator& operator -- ()
         {
-            if (p > 0) {
-                iterator it = p;
-                if (p->pPrev) {
-                    p = p->pPrev;
-                    return it;
-                }
-            }
-            p == nullptr;
+            p = p->pPrev;
             return *this;
         }
 
-        // two friends who need to access p directly
-        friend iterator list <T> ::insert(iterator it, const T& data);
-        friend iterator list <T> ::insert(iterator it, T&& data);
-        friend iterator list <T> ::erase(const iterator& it);
+        friend class list <T, A>;
 
 #ifdef DEBUG // make this visible to the unit tests
     public:
@@ -228,15 +863,17 @@ namespace custom
     private:
 #endif
 
-        typename list <T> ::Node* p;
+        typename list <T, A> ::Link* p;
     };
 
     /*****************************************
      * LIST :: NON-DEFAULT constructors
      * Create a list initialized to a value
      ****************************************/
-    template <typename T>
-    list <T> ::list(size_t num, const T& t)
+    template <typename T, typename A>
+    list <T, A> ::list(size_t num, const T& t, const A& a) :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(a),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
         // Fill constructor
         /*IF (num)
@@ -251,57 +888,52 @@ namespace custom
               pTail <- pNew
               numElements <- num*/
 
-        if (num) {
-            Node* pPrevious = pHead = pTail = new Node(T(t));
-            pHead->pPrev = nullptr;
-
-            for (int i = 1; i < num; i++) {
-                Node* pNew = new Node(T(t));
-                pNew->pPrev = pPrevious;
-                pNew->pPrev->pNext = pNew;
-                pPrevious = pNew;
-            }
-            pPrevious->pNext = nullptr;
-            pTail = pPrevious;
-        }
-        numElements = num;
+        // all num nodes are carved from a single block
+        constructBlock(num, [&]() -> const T& { return t; });
         //pHead = pTail = new Node(t);
         /*numElements = 99;
-        pHead = pTail = new list <T> ::Node();*/
+        pHead = pTail = new list <T, A> ::Node();*/
     }
 
     /*****************************************
      * LIST :: ITERATOR constructors
      * Create a list initialized to a set of values
      ****************************************/
-    template <typename T>
+    template <typename T, typename A>
     template <class Iterator>
-    list <T> ::list(Iterator first, Iterator last)
+    list <T, A> ::list(Iterator first, Iterator last, const A& a) :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(a),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
-        pHead = pTail = nullptr;
-        numElements = 0;
-        auto it = first;
-        while (it != last)
+        // when we can count the range up front, build it in one block
+        using category = typename std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value)
         {
-            push_back(*it);
-            it++;
+            size_t num = static_cast<size_t>(std::distance(first, last));
+            constructBlock(num, [&]() -> decltype(*first) { return *first++; });
+        }
+        else
+        {
+            auto it = first;
+            while (it != last)
+            {
+                push_back(*it);
+                it++;
+            }
         }
         /*numElements = 99;
-           pHead = pTail = new list <T> ::Node();*/
+           pHead = pTail = new list <T, A> ::Node();*/
     }
 
     /*****************************************
      * LIST :: INITIALIZER constructors
      * Create a list initialized to a set of values
      ****************************************/
-    template <typename T>
-    list <T> ::list(const std::initializer_list<T>& il)
+    template <typename T, typename A>
+    list <T, A> ::list(const std::initializer_list<T>& il, const A& a) :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(a),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
-        //pHead = pTail = nullptr;
-
-        numElements = 0;
-        pHead = pTail = nullptr;
-
         if (il.size() > 0)
         {
             for (T const item : il)
@@ -315,68 +947,90 @@ namespace custom
      * LIST :: NON-DEFAULT constructors
      * Create a list initialized to a value
      ****************************************/
-    template <typename T>
-    list <T> ::list(size_t num)
+    template <typename T, typename A>
+    list <T, A> ::list(size_t num, const A& a) :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(a),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
-        /*numElements = num;
-        pHead = pTail = nullptr;*/
-        if (num) {
-            Node* pPrevious = pHead = pTail = new Node(T(0));
-            pHead->pPrev = nullptr;
-
-            for (int i = 1; i < num; i++) {
-                Node* pNew = new Node(T(0));
-                pNew->pPrev = pPrevious;
-                pNew->pPrev->pNext = pNew;
-                pPrevious = pNew;
-            }
-            pPrevious->pNext = nullptr;
-            pTail = pPrevious;
-        }
-        numElements = num;
+        constructBlock(num, []() { return T(); });
         /*numElements = 99;
-        pHead = pTail = new list <T> ::Node();*/
+        pHead = pTail = new list <T, A> ::Node();*/
     }
 
     /*****************************************
      * LIST :: DEFAULT constructors - Finished | Alexander
      ****************************************/
-    template <typename T>
-    list <T> ::list()
+    template <typename T, typename A>
+    list <T, A> ::list() :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
-        numElements = 0;
-        pHead = pTail = nullptr;
         /*numElements = 99;
-           pHead = pTail = new list <T> ::Node();*/
+           pHead = pTail = new list <T, A> ::Node();*/
+    }
+
+    /*****************************************
+     * LIST :: ALLOCATOR constructor
+     * An empty list drawing its nodes from a
+     * given allocator
+     ****************************************/
+    template <typename T, typename A>
+    list <T, A> ::list(const A& a) :
+        numElements(0), sentinel{ &sentinel, &sentinel }, alloc(a),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
+    {
     }
 
     /*****************************************
      * LIST :: COPY constructors - Alexander
      ****************************************/
-    template <typename T>
-    list <T> ::list(list& rhs)
+    template <typename T, typename A>
+    list <T, A> ::list(list& rhs) :
+        numElements(0), sentinel{ &sentinel, &sentinel },
+        alloc(node_traits::select_on_container_copy_construction(rhs.alloc)),
+        pFree(nullptr), numFree(0), maxFree(0), blocks(alloc), pFill(nullptr), pIndex(nullptr)
     {
-        pHead = pTail = nullptr;
-        numElements = 0;
-        *this = rhs;
+        // not operator=, which may propagate rhs's allocator over ours
+        for (iterator it = rhs.begin(); it != rhs.end(); ++it)
+            push_back(*it);
         /*numElements = 99;
-           pHead = pTail = new list <T> ::Node();*/
+           pHead = pTail = new list <T, A> ::Node();*/
     }
 
     /*****************************************
      * LIST :: MOVE constructors - Finished
      * Steal the values from the RHS
      ****************************************/
-    template <typename T>
-    list <T> ::list(list <T>&& rhs)
+    template <typename T, typename A>
+    list <T, A> ::list(list <T, A>&& rhs) noexcept :
+        numElements(rhs.numElements), sentinel(rhs.sentinel), alloc(std::move(rhs.alloc)),
+        pFree(rhs.pFree), numFree(rhs.numFree), maxFree(rhs.maxFree), blocks(alloc),
+        pFill(rhs.pFill), pIndex(rhs.pIndex)
     {
-        pHead = rhs.pHead;
-        pTail = rhs.pTail;
-        numElements = rhs.numElements;
+        blocks.swap(rhs.blocks);
+        relinkSentinel();
+        rhs.pFill = nullptr;
+        rhs.pIndex = nullptr;
 
-        rhs.pHead = nullptr;
-        rhs.pTail = nullptr;
         rhs.numElements = 0;
+        rhs.relinkSentinel();
+        rhs.pFree = nullptr;
+        rhs.numFree = 0;
+    }
+
+    /*****************************************
+     * LIST :: RELINK SENTINEL
+     * The sentinel's links were just copied from another
+     * list, or the list was just emptied. Point the end
+     * nodes back at our own sentinel.
+     ****************************************/
+    template <typename T, typename A>
+    void list <T, A> ::relinkSentinel()
+    {
+        if (numElements == 0)
+            sentinel.pNext = sentinel.pPrev = &sentinel;
+        else
+            sentinel.pNext->pPrev = sentinel.pPrev->pNext = &sentinel;
     }
 
     /**********************************************
@@ -386,9 +1040,29 @@ namespace custom
      *     OUTPUT :
      *     COST   : O(n) with respect to the number of nodes
      *********************************************/
-    template <typename T>
-    list <T>& list <T> :: operator = (list <T>& rhs)
+    template <typename T, typename A>
+    list <T, A>& list <T, A> :: operator = (list <T, A>& rhs)
     {
+        if (this == &rhs)
+            return *this;
+
+        // a propagating allocator replaces ours, but nodes from
+        // the old one have to go back to it first, and so does the
+        // index, which is made again by the new one
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+        {
+            bool indexed = pIndex != nullptr;
+            if (alloc != rhs.alloc)
+            {
+                clear();
+                dropIndex();
+                release_cached_nodes();
+                releaseBlocks();
+            }
+            alloc = rhs.alloc;
+            set_positional_index(indexed);
+        }
+
         iterator itRHS = rhs.begin();
         iterator itLHS = begin();
         while (itRHS != rhs.end() && itLHS != end())
@@ -407,18 +1081,10 @@ namespace custom
         {
             clear();
         }
-        else if (itLHS != end())
+        else
         {
-            Node* p = itLHS.p;
-            pTail = p->pPrev;
-            Node* pNext = p->pNext;
-            while (p) {
-                pNext = p->pNext;
-                delete p;
-                p = pNext;
-                numElements--;
-            }
-            pTail->pNext = NULL;
+            while (itLHS != end())
+                itLHS = erase(itLHS);
         }
         /*clear();
         for (int i = 0; i < numElements; i++) {
@@ -440,23 +1106,97 @@ namespace custom
 
     /**********************************************
      * LIST :: assignment operator - MOVE - Alexander
-     * Copy one list onto another
+     * Copy one list onto another. Stealing the nodes never
+     * allocates, so it cannot throw when the allocators are
+     * sure to match.
      *     INPUT  : a list to be moved
      *     OUTPUT :
      *     COST   : O(n) with respect to the size of the LHS
      *********************************************/
-    template <typename T>
-    list <T>& list <T> :: operator = (list <T>&& rhs)
+    template <typename T, typename A>
+    list <T, A>& list <T, A> :: operator = (list <T, A>&& rhs)
+        noexcept(std::allocator_traits<A>::propagate_on_container_move_assignment::value ||
+                 std::allocator_traits<A>::is_always_equal::value)
     {
+        if (this == &rhs)
+            return *this;
+
+        // drop everything of ours so we can take their blocks whole
         clear();
-        swap(rhs);
-        /*numElements = rhs.numElements;
-        rhs.pHead = pTail = NULL;
-        rhs.numElements = 0;*/
+        release_cached_nodes();
+        releaseBlocks();
+
+        // we can only steal the nodes if our allocator can free them;
+        // our index has to go before the allocator that made it does
+        if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        {
+            dropIndex();
+            alloc = std::move(rhs.alloc);
+        }
+        else if (alloc != rhs.alloc)
+        {
+            for (iterator it = rhs.begin(); it != rhs.end(); ++it)
+                push_back(std::move(*it));
+            rhs.clear();
+            return *this;
+        }
+
+        sentinel = rhs.sentinel;
+        numElements = rhs.numElements;
+        relinkSentinel();
+        rhs.numElements = 0;
+        rhs.relinkSentinel();
+
+        // their spare nodes may live in their blocks too, so take both
+        pFree = rhs.pFree;
+        numFree = rhs.numFree;
+        rhs.pFree = nullptr;
+        rhs.numFree = 0;
+        blocks.swap(rhs.blocks);
+        pFill = rhs.pFill;
+        rhs.pFill = nullptr;
+
+        // an index of their nodes comes along with them
+        dropIndex();
+        pIndex = rhs.pIndex;
+        rhs.pIndex = nullptr;
 
         return *this;
     }
 
+    /**********************************************
+     * LIST :: SWAP
+     * Trade contents with another list. Only pointers
+     * change hands: the nodes, the spare nodes and the
+     * blocks they came from. The allocators are traded
+     * too when they propagate on swap; otherwise they
+     * have to be equal.
+     *     INPUT  : the list to trade with
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::swap(list <T, A>& rhs) noexcept
+    {
+        using std::swap;
+
+        if constexpr (node_traits::propagate_on_container_swap::value)
+            swap(alloc, rhs.alloc);
+        else
+            assert(alloc == rhs.alloc);
+
+        swap(sentinel, rhs.sentinel);
+        swap(numElements, rhs.numElements);
+        relinkSentinel();
+        rhs.relinkSentinel();
+        swap(pFree, rhs.pFree);
+        swap(numFree, rhs.numFree);
+        swap(maxFree, rhs.maxFree);
+        blocks.swap(rhs.blocks);
+        swap(pFill, rhs.pFill);
+        swap(pIndex, rhs.pIndex);
+    }
+
     /**********************************************
      * LIST :: assignment operator - Steve
      * Copy one list onto another
@@ -464,8 +1204,8 @@ namespace custom
      *     OUTPUT :
      *     COST   : O(n) with respect to the number of nodes
      *********************************************/
-    template <typename T>
-    list <T>& list <T> :: operator = (const std::initializer_list<T>& rhs)
+    template <typename T, typename A>
+    list <T, A>& list <T, A> :: operator = (const std::initializer_list<T>& rhs)
     {
         /*list.copy-assignment(rhs)
              itRHS <- rhs.begin() Fill existing nodes
@@ -502,7 +1242,7 @@ namespace custom
             data[i++] = item;
         }*/
 
-        const int* itRHS = rhs.begin();
+        const T* itRHS = rhs.begin();
         iterator itLHS = begin();
         while (itRHS != rhs.end() && itLHS != end())
         {
@@ -520,18 +1260,10 @@ namespace custom
         {
             clear();
         }
-        else if (itLHS != end())
+        else
         {
-            Node* p = itLHS.p;
-            pTail = p->pPrev;
-            Node* pNext = p->pNext;
-            while (p) {
-                pNext = p->pNext;
-                delete p;
-                p = pNext;
-                numElements--;
-            }
-            pTail->pNext = NULL;
+            while (itLHS != end())
+                itLHS = erase(itLHS);
         }
 
 
@@ -545,18 +1277,20 @@ namespace custom
      *     OUTPUT :
      *     COST   : O(n) with respect to the number of nodes
      *********************************************/
-    template <typename T>
-    void list <T> ::clear()
+    template <typename T, typename A>
+    void list <T, A> ::clear()
     {
-        // loop is unnecessary for the checks, but probably good practice
-        while (pHead != NULL)
+        Link* p = sentinel.pNext;
+        while (p != &sentinel)
         {
-            Node* pDelete = pHead;
-            pHead = pHead->pNext;
-            delete pDelete;
+            Node* pDelete = p->node();
+            p = p->pNext;
+            deleteNode(pDelete);
         }
-        pTail = nullptr;
+        sentinel.pNext = sentinel.pPrev = &sentinel;
         numElements = 0;
+        if (pIndex)
+            pIndex->clear();
     }
 
     /*********************************************
@@ -566,33 +1300,16 @@ namespace custom
      *    OUTPUT :
      *    COST   : O(1)
      *********************************************/
-    template <typename T>
-    void list <T> ::push_back(const T& data)
+    template <typename T, typename A>
+    void list <T, A> ::push_back(const T& data)
     {
-        Node* pNew = new Node(data);
-        pNew->pPrev = pTail;
-        if (pTail)
-            pTail->pNext = pNew;
-        else
-            pHead = pNew;
-
-        pTail = pNew;
-        numElements++;
+        emplace(end(), data);
     }
 
-    template <typename T>
-    void list <T> ::push_back(T&& data)
+    template <typename T, typename A>
+    void list <T, A> ::push_back(T&& data)
     {
-        Node* pNew = new Node(data);
-        pNew->pPrev = pTail;
-        if (pTail)
-            pTail->pNext = pNew;
-        else
-            pHead = pNew;
-
-        pTail = pNew;
-        numElements++;
-
+        emplace(end(), std::move(data));
     }
 
     /*********************************************
@@ -602,42 +1319,16 @@ namespace custom
      *     OUTPUT :
      *     COST   : O(1)
      *********************************************/
-    template <typename T>
-    void list <T> ::push_front(const T& data)
+    template <typename T, typename A>
+    void list <T, A> ::push_front(const T& data)
     {
-        Node* pNew = new Node(data);
-        if (pNew != nullptr) {
-            if (numElements == 0)
-            {
-                pHead = pTail = pNew;
-            }
-            else
-            {
-                pHead->pPrev = pNew;
-                pNew->pNext = pHead;
-                pHead = pNew;
-            }
-            numElements++;
-        }
+        emplace(begin(), data);
     }
 
-    template <typename T>
-    void list <T> ::push_front(T&& data)
+    template <typename T, typename A>
+    void list <T, A> ::push_front(T&& data)
     {
-        Node* pNew = new Node(data);
-        if (pNew != nullptr) {
-            if (numElements == 0)
-            {
-                pHead = pTail = pNew;
-            }
-            else
-            {
-                pHead->pPrev = pNew;
-                pNew->pNext = pHead;
-                pHead = pNew;
-            }
-            numElements++;
-        }
+        emplace(begin(), std::move(data));
     }
 
 
@@ -648,27 +1339,12 @@ namespace custom
      *    OUTPUT :
      *    COST   : O(1)
      *********************************************/
-    template <typename T>
-    void list <T> ::pop_back()
+    template <typename T, typename A>
+    void list <T, A> ::pop_back()
     {
         if (!empty())
-        {
-            if (numElements <= 1) {
-                pTail = pHead = nullptr;
-            }
-            else {
-                Node* pNew = pHead;
-
-                while (pNew != nullptr) {
-                    if (pNew->pNext == pTail)
-                        pNew->pNext = nullptr;
-                    pNew = pNew->pNext;
-                }
-                pTail = pTail->pPrev;
-            }
-            numElements--;
-        }
-    }
+            erase(iterator(sentinel.pPrev));
+    }
 
     /*********************************************
      * LIST :: POP FRONT
@@ -677,40 +1353,11 @@ namespace custom
      *    OUTPUT :
      *    COST   : O(1)
      *********************************************/
-    template <typename T>
-    void list <T> ::pop_front()
-    {
-        //taken from erase
-        /*itNext  end()
-         IF it.p.pNext Take care of any nodes after ‘it’
-             it.p.pNext.pPrev  it.p.pPrev
-             itNext  it.p.pNext
-         ELSE
-            pTail  pTail.pPrev
-         IF it.p.pPrev Take care of any nodes before ‘it’
-            it.p.pPrev.pNext  it.p.pNext
-         ELSE
-            pHead  pHead.pNext
-         DELETE it.p Delete then node
-         numElements--
-         RETURN itNext*/
+    template <typename T, typename A>
+    void list <T, A> ::pop_front()
+    {
         if (!empty())
-        {
-            if (numElements == 1 || numElements == NULL) {
-                pTail = pHead = nullptr;
-            }
-            else {
-                Node* pNew = pTail;
-
-                while (pNew != nullptr) {
-                    if (pNew->pPrev == pHead)
-                        pNew->pPrev = nullptr;
-                    pNew = pNew->pPrev;
-                }
-                pHead = pHead->pNext;
-            }
-            numElements > 0 ? numElements-- : 0;
-        }
+            erase(begin());
     }
 
     /*********************************************
@@ -720,13 +1367,13 @@ namespace custom
      *     OUTPUT : data to be displayed
      *     COST   : O(1)
      *********************************************/
-    template <typename T>
-    T& list <T> ::front()
+    template <typename T, typename A>
+    T& list <T, A> ::front()
     {
         size_t empty = 0;
         if (numElements == empty)
             return *(new T);
-        return pHead->data;
+        return sentinel.pNext->node()->data;
     }
 
     /*********************************************
@@ -736,13 +1383,13 @@ namespace custom
      *     OUTPUT : data to be displayed
      *     COST   : O(1)
      *********************************************/
-    template <typename T>
-    T& list <T> ::back()
+    template <typename T, typename A>
+    T& list <T, A> ::back()
     {
         size_t empty = 0;
         if (numElements == empty)
             return *(new T);
-        return pTail->data;
+        return sentinel.pPrev->node()->data;
     }
 
     /******************************************
@@ -752,36 +1399,156 @@ namespace custom
      *     OUTPUT : iterator to the new location
      *     COST   : O(1)
      ******************************************/
-    template <typename T>
-    typename list <T> ::iterator  list <T> ::erase(const list <T> ::iterator& it)
+    template <typename T, typename A>
+    typename list <T, A> ::iterator  list <T, A> ::erase(const list <T, A> ::iterator& it)
+    {
+        // the sentinel is not ours to erase
+        if (it.p == &sentinel)
+            return end();
+
+        // the same four pointers at the head, the tail or in between
+        Link* pNext = it.p->pNext;
+        it.p->pPrev->pNext = pNext;
+        pNext->pPrev = it.p->pPrev;
+        if (pIndex)
+            pIndex->erase(it.p);
+
+        deleteNode(it.p->node());
+        numElements--;
+        return iterator(pNext);
+    }
+
+    /******************************************
+     * LIST :: ERASE
+     * remove the items [first, last) from the list. The
+     * range is cut out with one relink at each end and
+     * then its nodes are destroyed in a single pass.
+     *     INPUT  : iterators to the first item being removed
+     *              and to the item after the last
+     *     OUTPUT : last
+     *     COST   : O(k) with respect to the items removed
+     ******************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::erase(const list <T, A> ::iterator& first,
+        const list <T, A> ::iterator& last)
+    {
+        if (first == last)
+            return last;
+        assert(first.p != &sentinel);
+        if (pIndex)
+            for (Link* p = first.p; p != last.p; p = p->pNext)
+                pIndex->erase(p);
+
+        // the range ends in null once it is cut out
+        Link* pBefore = first.p->pPrev;
+        last.p->pPrev->pNext = nullptr;
+        pBefore->pNext = last.p;
+        last.p->pPrev = pBefore;
+
+        numElements -= deleteChain(first.p);
+        return last;
+    }
+
+    /******************************************
+     * LIST :: REMOVE IF
+     * Remove every element pred is true of. Matches are
+     * unlinked as the list is walked and only destroyed once
+     * the walk is over, so remove(t) may be given one of
+     * our own elements. If pred throws, whatever was already
+     * unlinked is still destroyed.
+     *     INPUT  : which elements to remove
+     *     OUTPUT : how many were removed
+     *     COST   : O(n) with respect to the number of nodes
+     ******************************************/
+    template <typename T, typename A>
+    template <class Predicate>
+    size_t list <T, A> ::remove_if(Predicate pred)
     {
-        iterator itNext = end();
-        if (it.p != nullptr)
+        Link* pRemoved = nullptr;
+        Link** ppRemoved = &pRemoved;
+        size_t num = 0;
+        try
         {
-            if (it.p->pNext)
-            {
-                it.p->pNext->pPrev = it.p->pPrev;
-                itNext = it.p->pNext;
-            }
-            else
+            for (Link* p = sentinel.pNext; p != &sentinel; )
             {
-                /*pTail->pNext = nullptr;*/
-                pTail = it.p->pPrev;
+                Link* pNext = p->pNext;
+                if (pred(p->node()->data))
+                {
+                    p->pPrev->pNext = pNext;
+                    pNext->pPrev = p->pPrev;
+                    if (pIndex)
+                        pIndex->erase(p);
+                    *ppRemoved = p;
+                    ppRemoved = &p->pNext;
+                    num++;
+                }
+                p = pNext;
             }
+        }
+        catch (...)
+        {
+            *ppRemoved = nullptr;
+            numElements -= num;
+            deleteChain(pRemoved);
+            throw;
+        }
+        *ppRemoved = nullptr;
+        numElements -= num;
+        deleteChain(pRemoved);
+        return num;
+    }
 
-            if (it.p->pPrev)
-            {
-                it.p->pPrev->pNext = it.p->pNext;
-            }
-            else
+    /******************************************
+     * LIST :: UNIQUE
+     * Remove all but the first of every run of elements
+     * pred finds equal to the first of the run. Like
+     * remove_if, the nodes are destroyed after the walk.
+     *     INPUT  : when two elements count as equal
+     *     OUTPUT : how many were removed
+     *     COST   : O(n) with respect to the number of nodes
+     ******************************************/
+    template <typename T, typename A>
+    template <class BinaryPredicate>
+    size_t list <T, A> ::unique(BinaryPredicate pred)
+    {
+        if (numElements < 2)
+            return 0;
+
+        Link* pRemoved = nullptr;
+        Link** ppRemoved = &pRemoved;
+        size_t num = 0;
+        try
+        {
+            Link* pKept = sentinel.pNext;
+            for (Link* p = pKept->pNext; p != &sentinel; )
             {
-                /*pHead->pPrev = nullptr;*/
-                pHead = it.p->pNext;
+                Link* pNext = p->pNext;
+                if (pred(pKept->node()->data, p->node()->data))
+                {
+                    pKept->pNext = pNext;
+                    pNext->pPrev = pKept;
+                    if (pIndex)
+                        pIndex->erase(p);
+                    *ppRemoved = p;
+                    ppRemoved = &p->pNext;
+                    num++;
+                }
+                else
+                    pKept = p;
+                p = pNext;
             }
-            delete it.p;
-            numElements--;
         }
-        return itNext;
+        catch (...)
+        {
+            *ppRemoved = nullptr;
+            numElements -= num;
+            deleteChain(pRemoved);
+            throw;
+        }
+        *ppRemoved = nullptr;
+        numElements -= num;
+        deleteChain(pRemoved);
+        return num;
     }
 
     /******************************************
@@ -792,108 +1559,1588 @@ namespace custom
      *     OUTPUT : iterator to the new item
      *     COST   : O(1)
      ******************************************/
-    template <typename T>
-    typename list <T> ::iterator list <T> ::insert(list <T> ::iterator it,
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::insert(list <T, A> ::iterator it,
         const T& data)
     {
-        Node* pNew = new Node(data);
+        return emplace(it, data);
+    }
 
-        if (numElements == 0)
-        {
-            numElements = 1;
-            pHead = pTail = pNew;
-            return begin();
-        }
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::insert(list <T, A> ::iterator it,
+        T&& data)
+    {
+        return emplace(it, std::move(data));
+    }
 
-        if (it.p)
-        {
-            pNew->pNext = it.p;
-            pNew->pPrev = it.p->pPrev;
-            it.p->pPrev = pNew;
+    /******************************************
+     * LIST :: INSERT
+     * add several items to the middle of the list. The
+     * new nodes are linked to each other first and then to
+     * the list, so if one fails to build the list is as it was.
+     *     INPUT  : an iterator to the location where they are to be inserted
+     *              how many copies of which item,
+     *              or the items themselves
+     *     OUTPUT : iterator to the first new item, or it if there are none
+     *     COST   : O(k) with respect to the items inserted
+     ******************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::insert(list <T, A> ::iterator it,
+        size_t num, const T& t)
+    {
+        return insertChain(it, num, [&]() -> const T& { return t; });
+    }
 
-            if (pNew->pPrev)
-                pNew->pPrev->pNext = pNew;
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::insert(list <T, A> ::iterator it,
+        const std::initializer_list<T>& il)
+    {
+        return insert(it, il.begin(), il.end());
+    }
 
-            if (it.p == pHead)
-                pHead = pNew;
+    template <typename T, typename A>
+    template <class Iterator, class>
+    typename list <T, A> ::iterator list <T, A> ::insert(list <T, A> ::iterator it,
+        Iterator first, Iterator last)
+    {
+        // when we can count the range up front, build the chain directly
+        using category = typename std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value)
+        {
+            size_t num = static_cast<size_t>(std::distance(first, last));
+            return insertChain(it, num, [&]() -> decltype(*first) { return *first++; });
         }
         else
         {
-            pTail->pNext = pNew;
-            pNew->pPrev = pTail;
-            pTail = pNew;
+            // otherwise the range can only be read once, so read it into a list
+            list <T, A> lNew(first, last, allocator_type(alloc));
+            iterator itNew = lNew.begin();
+            splice(it, lNew);
+            return itNew == lNew.end() ? it : itNew;
+        }
+    }
+
+    /******************************************
+     * LIST :: EMPLACE
+     * build an item in its node in the middle of the list.
+     * Nothing is copied or moved, so T need not be copyable
+     *     INPUT  : an iterator to the location where it is to be inserted
+     *              the arguments for T's constructor
+     *     OUTPUT : iterator to the new item
+     *     COST   : O(1)
+     ******************************************/
+    template <typename T, typename A>
+    template <class ... Args>
+    typename list <T, A> ::iterator list <T, A> ::emplace(list <T, A> ::iterator it,
+        Args&& ... args)
+    {
+        Node* pNew = allocateNode(std::in_place, std::forward<Args>(args)...);
+        if (pIndex)
+        {
+            try
+            {
+                pIndex->insert(pNew, it.p);
+            }
+            catch (...)
+            {
+                deleteNode(pNew);
+                throw;
+            }
         }
 
+        // the same four pointers at the head, the tail or in between
+        pNew->pNext = it.p;
+        pNew->pPrev = it.p->pPrev;
+        it.p->pPrev->pNext = pNew;
+        it.p->pPrev = pNew;
+
         numElements++;
         return iterator(pNew);
-        /*return end();*/
     }
 
-    template <typename T>
-    typename list <T> ::iterator list <T> ::insert(list <T> ::iterator it,
-        T&& data)
+    /*********************************************
+     * LIST :: SORT
+     * Put the elements in order by relinking the nodes.
+     * Equal elements keep their order. If comp throws,
+     * every element is still in the list, in no particular
+     * order.
+     *     INPUT  : a strict weak ordering, std::less by default
+     *     OUTPUT :
+     *     COST   : O(n log n) comparisons, no allocations
+     *********************************************/
+    template <typename T, typename A>
+    template <class Compare>
+    void list <T, A> ::sort(Compare comp)
     {
-        Node* pNew = new Node(data);
+        if (numElements < 2)
+            return;
 
-        if (numElements == 0)
+        // unhook the ring so the run ends in null
+        Link* pRun = sentinel.pNext;
+        sentinel.pPrev->pNext = nullptr;
+        try
+        {
+            sortRun(pRun, comp);
+        }
+        catch (...)
+        {
+            adoptChain(pRun);
+            throw;
+        }
+        adoptChain(pRun);
+    }
+
+    /*********************************************
+     * LIST :: PARALLEL SORT
+     * Sort on several threads. The list is cut into one run
+     * per thread, each thread sorts its run, and then pairs
+     * of neighbouring runs are merged on their own threads,
+     * halving the runs each round. Nothing is copied and the
+     * only allocations are per thread, never per element.
+     * Equal elements keep their order. comp is copied for
+     * each thread. Lists too short to share out are sorted
+     * on the calling thread.
+     *     INPUT  : a strict weak ordering
+     *              how many threads, 0 for one per core
+     *     OUTPUT :
+     *     COST   : O(n log n / threads + n) time
+     *********************************************/
+    template <typename T, typename A>
+    template <class Compare>
+    void list <T, A> ::parallel_sort(Compare comp, size_t numThreads)
+    {
+        if (numThreads == 0)
+            numThreads = std::thread::hardware_concurrency();
+        size_t numRuns = numElements / parallelGrain;
+        if (numRuns > numThreads)
+            numRuns = numThreads;
+        if (numRuns < 2)
+        {
+            sort(comp);
+            return;
+        }
+
+        // cut the ring into numRuns null-terminated runs of about the same length
+        std::vector<Link*> runs(numRuns);
+        std::vector<std::exception_ptr> errors(numRuns);
+        Link* p = sentinel.pNext;
+        sentinel.pPrev->pNext = nullptr;
+        for (size_t i = 0; i < numRuns; i++)
         {
-            numElements = 1;
-            pHead = pTail = pNew;
-            return begin();
+            runs[i] = p;
+            size_t length = numElements / numRuns + (i < numElements % numRuns ? 1 : 0);
+            while (--length)
+                p = p->pNext;
+            Link* pNext = p->pNext;
+            p->pNext = nullptr;
+            p = pNext;
         }
 
-        if (it.p)
+        // run job(0) .. job(num - 1), each on its own thread if one can be had
+        auto runJobs = [&](size_t num, auto job)
         {
-            pNew->pNext = it.p;
-            pNew->pPrev = it.p->pPrev;
-            it.p->pPrev = pNew;
+            auto guarded = [&](size_t i)
+            {
+                try
+                {
+                    Compare compThread(comp);
+                    job(i, compThread);
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < num; i++)
+            {
+                try
+                {
+                    threads.emplace_back(guarded, i);
+                }
+                catch (...)
+                {
+                    guarded(i);
+                }
+            }
+            guarded(0);
+            for (std::thread& thread : threads)
+                thread.join();
+
+            for (size_t i = 0; i < num; i++)
+                if (errors[i])
+                {
+                    adoptChain(joinRuns(runs.data(), numRuns));
+                    std::rethrow_exception(errors[i]);
+                }
+        };
 
-            if (pNew->pPrev)
-                pNew->pPrev->pNext = pNew;
+        runJobs(numRuns, [&](size_t i, Compare& compThread)
+        {
+            sortRun(runs[i], compThread);
+        });
 
-            if (it.p == pHead)
-                pHead = pNew;
+        // merge neighbours until one run is left; a run left over waits a round
+        for (size_t num = numRuns; num > 1; num = (num + 1) / 2)
+        {
+            size_t numPairs = num / 2;
+            runJobs(numPairs, [&](size_t i, Compare& compThread)
+            {
+                Link* pLater = runs[2 * i + 1];
+                runs[2 * i + 1] = nullptr;
+                mergeRuns(runs[2 * i], pLater, compThread);
+            });
+            for (size_t i = 0; i < num; i += 2)
+            {
+                Link* pRun = runs[i];
+                runs[i] = nullptr;
+                runs[i / 2] = pRun;
+            }
         }
-        else
+
+        adoptChain(runs[0]);
+    }
+
+    /*********************************************
+     * LIST :: RADIX SORT
+     * Put the elements in order of an integral key, least
+     * significant byte first. Each pass deals the nodes out
+     * into one chain per byte value by relinking pNext and
+     * then strings the chains back together, so nothing is
+     * copied. Bytes that are the same in every key are not
+     * given a pass. pPrev is put right once at the end.
+     * Equal keys keep their order. If key throws, every
+     * element is still in the list, in no particular order.
+     *     INPUT  : the key of an element, an integer
+     *     OUTPUT :
+     *     COST   : O(n * sizeof(key)), no allocations
+     *********************************************/
+    template <typename T, typename A>
+    template <class KeyFn>
+    void list <T, A> ::radix_sort(KeyFn key)
+    {
+        using Key = std::decay_t<decltype(key(std::declval<T&>()))>;
+        static_assert(std::is_integral<Key>::value && !std::is_same<Key, bool>::value,
+                      "radix_sort needs an integral key");
+        using Bits = std::make_unsigned_t<Key>;
+
+        // flipping the sign bit puts negative keys before positive ones
+        const Bits flip = std::is_signed<Key>::value ? Bits(Bits(1) << (sizeof(Key) * 8 - 1)) : Bits(0);
+
+        if (numElements < 2)
+            return;
+
+        // unhook the ring so the run ends in null
+        Link* pRun = sentinel.pNext;
+        sentinel.pPrev->pNext = nullptr;
+
+        Link* pHeads[radixBuckets];
+        Link** ppTails[radixBuckets];
+
+        // string the chains together in byte order, followed by pRest
+        auto gather = [&](Link* pRest)
+        {
+            Link** ppEnd = &pRun;
+            for (size_t i = 0; i < radixBuckets; i++)
+                if (ppTails[i] != &pHeads[i])
+                {
+                    *ppEnd = pHeads[i];
+                    ppEnd = ppTails[i];
+                }
+            *ppEnd = pRest;
+        };
+
+        // the first pass also finds which bits differ between the keys
+        Bits ones = Bits(0);
+        Bits zeros = Bits(0);
+        for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8)
+        {
+            if (shift != 0 && (((ones & zeros) >> shift) & 0xff) == 0)
+                continue;
+
+            for (size_t i = 0; i < radixBuckets; i++)
+                ppTails[i] = &pHeads[i];
+
+            Link* pRest = pRun;
+            try
+            {
+                while (pRest)
+                {
+                    Bits bits = Bits(key(pRest->node()->data)) ^ flip;
+                    if (shift == 0)
+                    {
+                        ones |= bits;
+                        zeros |= Bits(~bits);
+                    }
+
+                    size_t i = (bits >> shift) & 0xff;
+                    *ppTails[i] = pRest;
+                    ppTails[i] = &pRest->pNext;
+                    pRest = pRest->pNext;
+                }
+            }
+            catch (...)
+            {
+                gather(pRest);
+                adoptChain(pRun);
+                throw;
+            }
+            gather(nullptr);
+        }
+        adoptChain(pRun);
+    }
+
+    /*********************************************
+     * LIST :: REVERSE
+     * Flip the order of the elements by trading pNext and
+     * pPrev in every node. The sentinel is flipped too, which
+     * trades the head and the tail.
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n), no allocations
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::reverse()
+    {
+        Link* p = &sentinel;
+        do
         {
-            pTail->pNext = pNew;
-            pNew->pPrev = pTail;
-            pTail = pNew;
+            std::swap(p->pNext, p->pPrev);
+            p = p->pPrev;
         }
+        while (p != &sentinel);
+        reindex();
+    }
 
-        numElements++;
-        return iterator(pNew);
-        /*return end();*/
+    /*********************************************
+     * LIST :: SPLICE
+     * Move every element of rhs in front of it. The nodes
+     * are relinked, never copied or allocated. The two
+     * lists must share an allocator.
+     *     INPUT  : where the elements go
+     *              the list they come from, left empty
+     *     OUTPUT :
+     *     COST   : O(1), plus O(b) for the blocks of rhs
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::splice(iterator it, list <T, A>& rhs)
+    {
+        if (this == &rhs || rhs.empty())
+            return;
+        assert(alloc == rhs.alloc);
+
+        adoptBlocks(rhs);
+        indexSplice(it.p, rhs, rhs.sentinel.pNext, &rhs.sentinel);
+        transfer(it.p, rhs.sentinel.pNext, &rhs.sentinel);
+        numElements += rhs.numElements;
+        rhs.numElements = 0;
     }
 
-    /**********************************************
-     * LIST :: assignment operator - MOVE
-     * Copy one list onto another
-     *     INPUT  : a list to be moved
+    /*********************************************
+     * LIST :: SPLICE
+     * Move one element of rhs in front of it
+     *     INPUT  : where the element goes
+     *              the list it comes from, which may be this one
+     *              the element to move
      *     OUTPUT :
-     *     COST   : O(n) with respect to the size of the LHS
+     *     COST   : O(1), plus O(b) for the blocks of rhs
      *********************************************/
-    template <typename T>
-    void swap(list <T>& lhs, list <T>& rhs)
+    template <typename T, typename A>
+    void list <T, A> ::splice(iterator it, list <T, A>& rhs, iterator itRHS)
     {
+        assert(itRHS.p != &rhs.sentinel);
+        if (it.p == itRHS.p || it.p == itRHS.p->pNext)
+            return;
 
-        /*list.swap(rhs)
-             tempHead <- rhs.pHead
-             rhs.pHead <- pHead
-             pHead <- tempHead
-             tempTail <- rhs.pTail
-             rhs.pTail <- pTail
-             pTail <- tempTail
-             tempElements <- rhs.numElements
-             rhs.numElements <- numElements
-             numElements <- tempElements
-            */
+        if (this != &rhs)
+        {
+            assert(alloc == rhs.alloc);
+            adoptBlocks(rhs);
+        }
+        indexSplice(it.p, rhs, itRHS.p, itRHS.p->pNext);
+        if (this != &rhs)
+        {
+            numElements++;
+            rhs.numElements--;
+        }
+        transfer(it.p, itRHS.p, itRHS.p->pNext);
+    }
+
+    /*********************************************
+     * LIST :: SPLICE
+     * Move the elements [first, last) of rhs in front of it.
+     * Between two lists the elements have to be counted;
+     * pass the count when it is known to keep this O(1).
+     *     INPUT  : where the elements go
+     *              the list they come from, which may be this one
+     *              as long as it is not inside the range
+     *              the range to move
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the elements moved
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::splice(iterator it, list <T, A>& rhs, iterator first, iterator last)
+    {
+        size_t num = 0;
+        if (this != &rhs)
+            for (Link* p = first.p; p != last.p; p = p->pNext)
+                num++;
+        splice(it, rhs, first, last, num);
+    }
+
+    /*********************************************
+     * LIST :: SPLICE
+     * Move the elements [first, last) of rhs in front of it
+     * when the caller already knows how many there are
+     *     INPUT  : where the elements go
+     *              the list they come from, which may be this one
+     *              as long as it is not inside the range
+     *              the range to move and how many it holds
+     *     OUTPUT :
+     *     COST   : O(1), plus O(b) for the blocks of rhs
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::splice(iterator it, list <T, A>& rhs, iterator first, iterator last, size_t num)
+    {
+        if (first == last)
+            return;
+
+        if (this != &rhs)
+        {
+            assert(alloc == rhs.alloc);
+            assert(num <= rhs.numElements);
+            adoptBlocks(rhs);
+        }
+        indexSplice(it.p, rhs, first.p, last.p);
+        if (this != &rhs)
+        {
+            numElements += num;
+            rhs.numElements -= num;
+        }
+        transfer(it.p, first.p, last.p);
+    }
+
+    /*********************************************
+     * LIST :: MERGE
+     * Move the elements of rhs in among ours, both lists
+     * being sorted by comp. Each run of rhs elements that
+     * goes in front of one of ours is relinked in one go.
+     * Equal elements keep their order, ours first. If comp
+     * throws, both lists are intact and every element is in
+     * one of them, though no longer in order.
+     *     INPUT  : the list to take the elements of, left empty
+     *              the strict weak ordering both are sorted by
+     *     OUTPUT :
+     *     COST   : O(n + m) comparisons, plus O(b) for the blocks of rhs
+     *********************************************/
+    template <typename T, typename A>
+    template <class Compare>
+    void list <T, A> ::merge(list <T, A>& rhs, Compare comp)
+    {
+        if (this == &rhs || rhs.empty())
+            return;
+        assert(alloc == rhs.alloc);
+
+        adoptBlocks(rhs);
+        if (pIndex)
+        {
+            try
+            {
+                for (Link* p = rhs.sentinel.pNext; p != &rhs.sentinel; p = p->pNext)
+                    pIndex->insert(p, &sentinel);
+            }
+            catch (...)
+            {
+                for (Link* p = rhs.sentinel.pNext; p != &rhs.sentinel; p = p->pNext)
+                    pIndex->erase(p);
+                throw;
+            }
+        }
+
+        Link* pOurs = sentinel.pNext;
+        Link* pTheirs = rhs.sentinel.pNext;
+        size_t numMoved = 0;
+        try
+        {
+            while (pOurs != &sentinel && pTheirs != &rhs.sentinel)
+            {
+                if (!comp(pTheirs->node()->data, pOurs->node()->data))
+                {
+                    pOurs = pOurs->pNext;
+                    continue;
+                }
+
+                // find the end of the run that belongs in front of pOurs
+                Link* pLast = pTheirs->pNext;
+                size_t num = 1;
+                while (pLast != &rhs.sentinel && comp(pLast->node()->data, pOurs->node()->data))
+                {
+                    pLast = pLast->pNext;
+                    num++;
+                }
+                transfer(pOurs, pTheirs, pLast);
+                pTheirs = pLast;
+                numMoved += num;
+            }
+        }
+        catch (...)
+        {
+            numElements += numMoved;
+            rhs.numElements -= numMoved;
+
+            // each index gives up the nodes that ended up in the other list
+            if (pIndex)
+                for (Link* p = rhs.sentinel.pNext; p != &rhs.sentinel; p = p->pNext)
+                    pIndex->erase(p);
+            if (rhs.pIndex)
+                for (Link* p = sentinel.pNext; p != &sentinel; p = p->pNext)
+                    rhs.pIndex->erase(p);
+            reindex();
+            rhs.reindex();
+            throw;
+        }
+
+        // whatever is left of theirs goes after all of ours
+        transfer(&sentinel, pTheirs, &rhs.sentinel);
+        numElements += rhs.numElements;
+        rhs.numElements = 0;
+        reindex();
+        if (rhs.pIndex)
+            rhs.pIndex->clear();
+    }
+
+    /*********************************************
+     * LIST :: SORT RUN
+     * Bottom-up merge sort of a run linked through pNext.
+     * Runs of 1, 2, 4, ... nodes wait in bins, the way a
+     * binary counter carries, so the only extra memory is
+     * one pointer per bit of the run's length. If comp
+     * throws, pRun holds every node in no particular order.
+     *     INPUT  : the run, the ordering
+     *     OUTPUT : pRun, sorted
+     *     COST   : O(n log n) comparisons, no allocations
+     *********************************************/
+    template <typename T, typename A>
+    template <class Compare>
+    void list <T, A> ::sortRun(Link*& pRun, Compare& comp)
+    {
+        // bins[i] is empty or holds a sorted run of 2^i nodes,
+        // and every run in a higher bin came from earlier in the list
+        Link* bins[sizeof(size_t) * 8] = { };
+        size_t numBins = 0;
+        Link* pRest = pRun;
+        Link* pCarry = nullptr;
+        try
+        {
+            while (pRest)
+            {
+                pCarry = pRest;
+                pRest = pRest->pNext;
+                pCarry->pNext = nullptr;
+
+                size_t i = 0;
+                for (; bins[i]; i++)
+                {
+                    Link* pLater = pCarry;
+                    pCarry = nullptr;
+                    mergeRuns(bins[i], pLater, comp);
+                    pCarry = bins[i];
+                    bins[i] = nullptr;
+                }
+                bins[i] = pCarry;
+                pCarry = nullptr;
+                if (i == numBins)
+                    numBins++;
+            }
+
+            // fold the bins together, the smaller, later runs first
+            for (size_t i = 1; i < numBins; i++)
+            {
+                Link* pLater = bins[i - 1];
+                bins[i - 1] = nullptr;
+                mergeRuns(bins[i], pLater, comp);
+            }
+        }
+        catch (...)
+        {
+            // string everything back together so nothing is lost
+            Link* pLeft[3] = { joinRuns(bins, numBins), pCarry, pRest };
+            pRun = joinRuns(pLeft, 3);
+            throw;
+        }
+        pRun = numBins ? bins[numBins - 1] : nullptr;
+    }
+
+    /*********************************************
+     * LIST :: JOIN RUNS
+     * String runs linked through pNext end to end
+     *     INPUT  : the runs, any of which may be null
+     *     OUTPUT : the first node of the joined run
+     *     COST   : O(n) with respect to the number of nodes
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::Link* list <T, A> ::joinRuns(Link** pRuns, size_t num)
+    {
+        Link* pFirst = nullptr;
+        Link** ppLink = &pFirst;
+        for (size_t i = 0; i < num; i++)
+        {
+            *ppLink = pRuns[i];
+            while (*ppLink)
+                ppLink = &(*ppLink)->pNext;
+        }
+        return pFirst;
+    }
+
+    /*********************************************
+     * LIST :: MERGE RUNS
+     * Merge two sorted runs linked through pNext. Nodes of
+     * pRun come first when elements compare equal. The
+     * result goes back in pRun as it is built, so even if
+     * comp throws, pRun holds every node of both runs.
+     *     INPUT  : the earlier run, the later run, the ordering
+     *     OUTPUT : pRun, the merged run
+     *     COST   : O(n) with respect to the length of the runs
+     *********************************************/
+    template <typename T, typename A>
+    template <class Compare>
+    void list <T, A> ::mergeRuns(Link*& pRun, Link* pLater, Compare& comp)
+    {
+        Link* pEarlier = pRun;
+        Link** ppLink = &pRun;
+        try
+        {
+            while (pEarlier && pLater)
+            {
+                if (comp(pLater->node()->data, pEarlier->node()->data))
+                {
+                    *ppLink = pLater;
+                    pLater = pLater->pNext;
+                }
+                else
+                {
+                    *ppLink = pEarlier;
+                    pEarlier = pEarlier->pNext;
+                }
+                ppLink = &(*ppLink)->pNext;
+            }
+        }
+        catch (...)
+        {
+            *ppLink = pEarlier;
+            while (*ppLink)
+                ppLink = &(*ppLink)->pNext;
+            *ppLink = pLater;
+            throw;
+        }
+        *ppLink = pEarlier ? pEarlier : pLater;
+    }
+
+    /*********************************************
+     * LIST :: ADOPT CHAIN
+     * Take a chain of all our nodes, linked through pNext
+     * and ending in null, and make it the ring again,
+     * bringing the index in line with the new order
+     *     INPUT  : the first node of the chain
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of nodes
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::adoptChain(Link* pFirst)
+    {
+        Link* pPrev = &sentinel;
+        for (Link* p = pFirst; p; p = p->pNext)
+        {
+            p->pPrev = pPrev;
+            pPrev = p;
+        }
+        pPrev->pNext = &sentinel;
+        sentinel.pNext = pFirst;
+        sentinel.pPrev = pPrev;
+        reindex();
+    }
+
+    /*********************************************
+     * LIST :: TRANSFER
+     * Unhook the nodes [pFirst, pLast) and hook them back in
+     * front of pPos, which must not be among them. Either
+     * end may be a sentinel.
+     *     INPUT  : where the nodes go
+     *              the nodes to move
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::transfer(Link* pPos, Link* pFirst, Link* pLast)
+    {
+        if (pFirst == pLast || pPos == pLast)
+            return;
+
+        Link* pTail = pLast->pPrev;
 
-        list <T> tempHead = rhs;
-        rhs = lhs;
-        lhs = tempHead;
+        // close the gap they leave behind
+        pFirst->pPrev->pNext = pLast;
+        pLast->pPrev = pFirst->pPrev;
+
+        // and open one in front of pPos
+        pFirst->pPrev = pPos->pPrev;
+        pTail->pNext = pPos;
+        pPos->pPrev->pNext = pFirst;
+        pPos->pPrev = pTail;
     }
 
+    /*********************************************
+     * LIST :: ADOPT BLOCKS
+     * Claim every block of rhs we do not hold already, so
+     * that nodes carved from them can be freed from here
+     *     INPUT  : the list nodes are coming from
+     *     OUTPUT :
+     *     COST   : O(c * b) with respect to the blocks of each list
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::adoptBlocks(const list <T, A>& rhs)
+    {
+        for (Block* pBlock : rhs.blocks)
+        {
+            // a block whose storage is gone has no nodes left to move
+            if (pBlock->live == 0)
+                continue;
+
+            auto it = findBlock(pBlock->pNodes);
+            if (it == blocks.end() || *it != pBlock)
+            {
+                addBlock(pBlock);
+                pBlock->owners++;
+            }
+        }
+    }
+
+    /*********************************************
+     * LIST :: INDEX SPLICE
+     * Before [pFirst, pLast) of rhs moves in front of pPos,
+     * tell the indexes. If ours cannot make room for them,
+     * it is put back as it was.
+     *     INPUT  : where the nodes go
+     *              the list they come from, which may be this one
+     *              the nodes to move
+     *     OUTPUT :
+     *     COST   : O(k log n) with respect to the nodes moved
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::indexSplice(Link* pPos, list <T, A>& rhs, Link* pFirst, Link* pLast)
+    {
+        if (this == &rhs)
+        {
+            if (pIndex)
+                for (Link* p = pFirst; p != pLast; p = p->pNext)
+                    pIndex->move(p, pPos);
+            return;
+        }
+
+        if (pIndex)
+        {
+            try
+            {
+                for (Link* p = pFirst; p != pLast; p = p->pNext)
+                    pIndex->insert(p, pPos);
+            }
+            catch (...)
+            {
+                for (Link* p = pFirst; p != pLast; p = p->pNext)
+                    pIndex->erase(p);
+                throw;
+            }
+        }
+        if (rhs.pIndex)
+            for (Link* p = pFirst; p != pLast; p = p->pNext)
+                rhs.pIndex->erase(p);
+    }
+
+    /*********************************************
+     * LIST :: ALLOCATE NODE
+     * Create a new node through the allocator, forwarding
+     * the arguments on to the Node constructor
+     *     INPUT  : arguments for the Node constructor
+     *     OUTPUT : the new unlinked node
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    template <class ... Args>
+    typename list <T, A> ::Node* list <T, A> ::allocateNode(Args&& ... args)
+    {
+        Node* pNew;
+        if (pFree)
+        {
+            pNew = pFree;
+            pFree = *reinterpret_cast<Node**>(pFree);
+            numFree--;
+        }
+        else
+            pNew = newStorage();
+
+        try
+        {
+            node_traits::construct(alloc, pNew, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            freeStorage(pNew);
+            throw;
+        }
+        return pNew;
+    }
+
+    /*********************************************
+     * LIST :: DELETE NODE
+     * Destroy a node and give its memory back to the allocator
+     *     INPUT  : an unlinked node
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::deleteNode(Node* p)
+    {
+        node_traits::destroy(alloc, p);
+
+        // keep it for the next insert if there is room in the cache
+        if (numFree < maxFree)
+        {
+            ::new (static_cast<void*>(p)) Node*(pFree);
+            pFree = p;
+            numFree++;
+        }
+        else
+            freeStorage(p);
+    }
+
+    /*********************************************
+     * LIST :: DELETE CHAIN
+     * Destroy a run of unlinked nodes, linked through pNext
+     * and ending in null
+     *     INPUT  : the first node of the chain
+     *     OUTPUT : how many nodes there were
+     *     COST   : O(k) with respect to the nodes in the chain
+     *********************************************/
+    template <typename T, typename A>
+    size_t list <T, A> ::deleteChain(Link* pFirst)
+    {
+        size_t num = 0;
+        while (pFirst)
+        {
+            Node* pDelete = pFirst->node();
+            pFirst = pFirst->pNext;
+            deleteNode(pDelete);
+            num++;
+        }
+        return num;
+    }
+
+    /*********************************************
+     * LIST :: INSERT CHAIN
+     * Build num nodes linked to each other but not to us,
+     * then link the whole chain in front of it with one
+     * update at each end. If a node fails to build, the
+     * ones already built are destroyed and the list is
+     * untouched.
+     *     INPUT  : where the nodes go
+     *              how many to build
+     *              a generator returning each successive value
+     *     OUTPUT : iterator to the first new node, or it if there are none
+     *     COST   : O(k) with respect to the nodes built
+     *********************************************/
+    template <typename T, typename A>
+    template <class Generator>
+    typename list <T, A> ::iterator list <T, A> ::insertChain(iterator it, size_t num, Generator next)
+    {
+        if (num == 0)
+            return it;
+
+        Link* pFirst = nullptr;
+        Link** ppLink = &pFirst;
+        Link* pPrev = it.p->pPrev;
+        try
+        {
+            for (size_t i = 0; i < num; i++)
+            {
+                Node* pNew = allocateNode(std::in_place, next());
+                pNew->pPrev = pPrev;
+                *ppLink = pNew;
+                ppLink = &pNew->pNext;
+                pPrev = pNew;
+                if (pIndex)
+                    pIndex->insert(pNew, it.p);
+            }
+        }
+        catch (...)
+        {
+            *ppLink = nullptr;
+            if (pIndex)
+                for (Link* p = pFirst; p; p = p->pNext)
+                    pIndex->erase(p);
+            deleteChain(pFirst);
+            throw;
+        }
+
+        pPrev->pNext = it.p;
+        it.p->pPrev->pNext = pFirst;
+        it.p->pPrev = pPrev;
+        numElements += num;
+        return iterator(pFirst);
+    }
+
+    /*********************************************
+     * LIST :: CONSTRUCT BLOCK
+     * Build an empty list up to num elements, carving every
+     * node from one allocation and linking them in order
+     *     INPUT  : the number of nodes
+     *              a generator returning each successive value
+     *     OUTPUT :
+     *     COST   : O(n) with a single allocation
+     *********************************************/
+    template <typename T, typename A>
+    template <class Generator>
+    void list <T, A> ::constructBlock(size_t num, Generator next)
+    {
+        if (num == 0)
+            return;
+
+        Node* pNodes = node_traits::allocate(alloc, num);
+        size_t i = 0;
+        try
+        {
+            for (; i < num; i++)
+                node_traits::construct(alloc, pNodes + i, next());
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+                node_traits::destroy(alloc, pNodes + i);
+            node_traits::deallocate(alloc, pNodes, num);
+            throw;
+        }
+
+        // remember the block so erase knows not to free its nodes one by one
+        block_allocator blockAlloc(alloc);
+        Block* pBlock = block_traits::allocate(blockAlloc, 1);
+        block_traits::construct(blockAlloc, pBlock, Block{ pNodes, num, num, num, 1 });
+        try
+        {
+            addBlock(pBlock);
+        }
+        catch (...)
+        {
+            block_traits::deallocate(blockAlloc, pBlock, 1);
+            for (i = 0; i < num; i++)
+                node_traits::destroy(alloc, pNodes + i);
+            node_traits::deallocate(alloc, pNodes, num);
+            throw;
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            pNodes[i].pPrev = (i == 0 ? &sentinel : pNodes + i - 1);
+            pNodes[i].pNext = (i + 1 == num ? &sentinel : pNodes + i + 1);
+        }
+        sentinel.pNext = pNodes;
+        sentinel.pPrev = pNodes + num - 1;
+        numElements = num;
+    }
+
+    /*********************************************
+     * LIST :: FREE STORAGE
+     * Give the memory of a destroyed node back. A lone node
+     * goes to the thread's node cache or the allocator; a node
+     * from a block only frees the block once its last node is gone.
+     *     INPUT  : storage of a destroyed node
+     *     OUTPUT :
+     *     COST   : O(log b) with respect to the number of blocks
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::freeStorage(Node* p)
+    {
+        if (returnToBlock(p))
+            return;
+        if constexpr (threadCached)
+        {
+            if (node_cache<node_allocator>::put(p))
+                return;
+        }
+        node_traits::deallocate(alloc, p, 1);
+    }
+
+    /*********************************************
+     * LIST :: FIND BLOCK
+     * The block in our registry a node was carved from
+     *     INPUT  : any node
+     *     OUTPUT : where its block sits in the registry, or
+     *              blocks.end() if it is a lone node
+     *     COST   : O(log b) with respect to the number of blocks
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::block_registry::iterator list <T, A> ::findBlock(const Node* p)
+    {
+        // the last block that starts at or before p is the only one it can be in
+        std::less<const Node*> less;
+        auto it = std::upper_bound(blocks.begin(), blocks.end(), p,
+            [&less](const Node* p, const Block* pBlock) { return less(p, pBlock->pNodes); });
+        if (it == blocks.begin())
+            return blocks.end();
+
+        --it;
+        if ((*it)->live == 0 || !less(p, (*it)->pNodes + (*it)->capacity))
+            return blocks.end();
+        return it;
+    }
+
+    /*********************************************
+     * LIST :: ADD BLOCK
+     * Put a block in the registry in order of address. A
+     * block freed by another list may still be listed here,
+     * and new storage could land where it was, so those are
+     * cleared out first.
+     *     INPUT  : the block, which we already count as an owner
+     *     OUTPUT :
+     *     COST   : O(b) with respect to the number of blocks
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::addBlock(Block* pBlock)
+    {
+        blocks.reserve(blocks.size() + 1);
+
+        block_allocator blockAlloc(alloc);
+        auto itDead = blocks.begin();
+        for (Block* pOld : blocks)
+        {
+            if (pOld->live != 0)
+                *itDead++ = pOld;
+            else
+            {
+                if (pOld == pFill)
+                    pFill = nullptr;
+                if (--pOld->owners == 0)
+                    block_traits::deallocate(blockAlloc, pOld, 1);
+            }
+        }
+        blocks.erase(itDead, blocks.end());
+
+        std::less<const Node*> less;
+        blocks.insert(std::upper_bound(blocks.begin(), blocks.end(), pBlock,
+            [&less](const Block* pLHS, const Block* pRHS) { return less(pLHS->pNodes, pRHS->pNodes); }),
+            pBlock);
+    }
+
+    /*********************************************
+     * LIST :: RETURN TO BLOCK
+     * If a destroyed node was carved from one of our blocks,
+     * give it back to that block. The last node back frees the
+     * block's storage, and the block leaves our registry.
+     *     INPUT  : storage of a destroyed node
+     *     OUTPUT : false if it is a lone node, still to be freed
+     *     COST   : O(log b) with respect to the number of blocks
+     *********************************************/
+    template <typename T, typename A>
+    bool list <T, A> ::returnToBlock(Node* p)
+    {
+        auto it = findBlock(p);
+        if (it == blocks.end())
+            return false;
+
+        Block* pBlock = *it;
+        if (--pBlock->live == 0)
+        {
+            node_traits::deallocate(alloc, pBlock->pNodes, pBlock->capacity);
+            if (pBlock == pFill)
+                pFill = nullptr;
+            blocks.erase(it);
+
+            // anyone else holding it sees live is 0 and lets go in time
+            if (--pBlock->owners == 0)
+            {
+                block_allocator blockAlloc(alloc);
+                block_traits::deallocate(blockAlloc, pBlock, 1);
+            }
+        }
+        return true;
+    }
+
+    /*********************************************
+     * LIST :: NEW STORAGE
+     * Find room for one node, from the thread's node cache
+     * when the allocator allows it, else from the allocator
+     *     INPUT  :
+     *     OUTPUT : uninitialized storage for one node
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::Node* list <T, A> ::newStorage()
+    {
+        if constexpr (threadCached)
+        {
+            Node* p = node_cache<node_allocator>::get();
+            if (p)
+                return p;
+        }
+        return node_traits::allocate(alloc, 1);
+    }
+
+    /*********************************************
+     * LIST :: RELOCATE
+     * Move num nodes, starting at pFirst, to the next free
+     * slots of the block compact is filling, laid out in list
+     * order, then give the old nodes back. A pass over the
+     * list starts at the front with a block big enough for all
+     * of it, so the rest of the pass goes on in that one block;
+     * only if the list grows in the meantime does it need
+     * another, for what the first could not hold. A pass that
+     * starts part way has no idea how far it will go, so its
+     * first block holds just num and each one after that twice
+     * the last. Elements
+     * are moved if that cannot throw and copied otherwise,
+     * so if anything fails the list is as it was.
+     *     INPUT  : the first node to move
+     *              how many, no more than there are before the end
+     *     OUTPUT : the link after the last one moved
+     *     COST   : O(num log b), plus O(num log n) with the positional index
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::Link* list <T, A> ::relocate(Link* pFirst, size_t num)
+    {
+        if (num == 0)
+            return pFirst;
+
+        // a pass that starts over at the front starts a new block too
+        if (pFirst == sentinel.pNext || (pFill && pFill->live == 0))
+            pFill = nullptr;
+
+        // the new home, either the rest of the block we are filling or a new one
+        Block* pBlock = pFill;
+        Node* pNodes;
+        size_t capacity = 0;
+        if (pBlock && pBlock->capacity - pBlock->used >= num)
+            pNodes = pBlock->pNodes + pBlock->used;
+        else
+        {
+            // a pass from the front makes room for the whole list; a pass
+            // that started part way takes what it asked for, then twice
+            // the last block each time it runs out, never more than what
+            // is not already in the block we filled
+            if (pFirst == sentinel.pNext)
+                capacity = numElements;
+            else
+            {
+                size_t left = numElements;
+                if (pBlock)
+                    left = pBlock->live < numElements ? numElements - pBlock->live : 0;
+                capacity = pBlock ? 2 * pBlock->capacity : num;
+                if (capacity > left)
+                    capacity = left;
+            }
+            if (capacity < num)
+                capacity = num;
+            pBlock = nullptr;
+            pNodes = node_traits::allocate(alloc, capacity);
+        }
+
+        size_t numBuilt = 0;
+        Link* pOld;
+        try
+        {
+            // the index learns of each new node just in front of the old one
+            if (pIndex)
+            {
+                pOld = pFirst;
+                for (size_t i = 0; i < num; i++, pOld = pOld->pNext)
+                    pIndex->insert(pNodes + i, pOld);
+            }
+
+            for (pOld = pFirst; numBuilt < num; numBuilt++, pOld = pOld->pNext)
+                node_traits::construct(alloc, pNodes + numBuilt, std::in_place,
+                                       std::move_if_noexcept(pOld->node()->data));
+
+            // registered so erase knows where its nodes came from
+            if (!pBlock)
+            {
+                block_allocator blockAlloc(alloc);
+                pBlock = block_traits::allocate(blockAlloc, 1);
+                block_traits::construct(blockAlloc, pBlock, Block{ pNodes, capacity, 0, num, 1 });
+                try
+                {
+                    addBlock(pBlock);
+                }
+                catch (...)
+                {
+                    block_traits::deallocate(blockAlloc, pBlock, 1);
+                    pBlock = nullptr;
+                    throw;
+                }
+                pFill = pBlock;
+            }
+            else
+                pBlock->live += num;
+        }
+        catch (...)
+        {
+            if (pIndex)
+                for (size_t i = 0; i < num; i++)
+                    pIndex->erase(pNodes + i);
+            while (numBuilt-- > 0)
+                node_traits::destroy(alloc, pNodes + numBuilt);
+            if (capacity)
+                node_traits::deallocate(alloc, pNodes, capacity);
+            throw;
+        }
+        pBlock->used += num;
+
+        // swap the new run in for the old one
+        Link* pBefore = pFirst->pPrev;
+        Link* pAfter = pFirst;
+        size_t i;
+        for (i = 0; i < num; i++)
+            pAfter = pAfter->pNext;
+        for (i = 0; i < num; i++)
+        {
+            pNodes[i].pPrev = (i == 0 ? pBefore : pNodes + i - 1);
+            pNodes[i].pNext = (i + 1 == num ? pAfter : pNodes + i + 1);
+        }
+        pBefore->pNext = pNodes;
+        pAfter->pPrev = pNodes + num - 1;
+
+        // and let the old nodes go for good, rather than into either
+        // cache where the next insert would pick them up again
+        for (i = 0, pOld = pFirst; i < num; i++)
+        {
+            Node* pDelete = pOld->node();
+            pOld = pOld->pNext;
+            if (pIndex)
+                pIndex->erase(pDelete);
+            node_traits::destroy(alloc, pDelete);
+            if (!returnToBlock(pDelete))
+                node_traits::deallocate(alloc, pDelete, 1);
+        }
+
+        // the pass is over once it reaches the end
+        if (pAfter == &sentinel)
+            pFill = nullptr;
+        return pAfter;
+    }
+
+    /*********************************************
+     * LIST :: RELEASE BLOCKS
+     * Drop our claim on every block. A block is forgotten by
+     * the last list to let go of it; by then its nodes are gone.
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(b) with respect to the number of blocks
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::releaseBlocks()
+    {
+        block_allocator blockAlloc(alloc);
+        for (Block* pBlock : blocks)
+            if (--pBlock->owners == 0)
+            {
+                assert(pBlock->live == 0);
+                block_traits::deallocate(blockAlloc, pBlock, 1);
+            }
+        blocks.clear();
+        pFill = nullptr;
+    }
+
+    /*********************************************
+     * LIST :: SET NODE RECYCLING
+     * Keep up to highWater erased nodes around for reuse
+     * by the next push or insert. Zero turns recycling off.
+     * Anything cached beyond the new mark is freed now.
+     *     INPUT  : the most nodes to hold on to
+     *     OUTPUT :
+     *     COST   : O(k) with respect to the nodes trimmed
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::set_node_recycling(size_t highWater)
+    {
+        maxFree = highWater;
+        while (numFree > maxFree)
+        {
+            Node* pDelete = pFree;
+            pFree = *reinterpret_cast<Node**>(pFree);
+            freeStorage(pDelete);
+            numFree--;
+        }
+    }
+
+    /*********************************************
+     * LIST :: RELEASE CACHED NODES
+     * Give every recycled node back to the allocator. The
+     * high-water mark is left alone.
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(k) with respect to the cached nodes
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::release_cached_nodes()
+    {
+        while (pFree)
+        {
+            Node* pDelete = pFree;
+            pFree = *reinterpret_cast<Node**>(pFree);
+            freeStorage(pDelete);
+        }
+        numFree = 0;
+    }
+
+    /*********************************************
+     * LIST :: COMPACT
+     * Move the next num elements, starting at it, into fresh
+     * storage so that they sit side by side in list order.
+     * Call it again with what it returns to do the next
+     * stretch, which keeps each call bounded; every stretch
+     * of a pass from begin() goes into the same block, right
+     * after the one before. Iterators to the moved elements
+     * become invalid.
+     *     INPUT  : where to start, begin() to start a pass
+     *              the most elements to move this time
+     *     OUTPUT : where to start next time, end() when done
+     *     COST   : O(num log b)
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::compact(iterator it, size_t num)
+    {
+        size_t numLeft = 0;
+        for (Link* p = it.p; p != &sentinel && numLeft < num; p = p->pNext)
+            numLeft++;
+        return iterator(relocate(it.p, numLeft));
+    }
+
+    /*********************************************
+     * LIST :: SET POSITIONAL INDEX
+     * Turn the positional index on or off. While it is on,
+     * at, iterator_at, index_of and advance take O(log n),
+     * every insert and erase takes O(log n) to keep it up
+     * to date, and anything that reorders the list takes
+     * O(n) more. While it is off, none of that costs a thing
+     * and the positional calls walk the list instead.
+     *     INPUT  : whether to keep an index
+     *     OUTPUT :
+     *     COST   : O(n log n) to turn on, O(n) to turn off
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::set_positional_index(bool on)
+    {
+        if (!on)
+        {
+            dropIndex();
+            return;
+        }
+        if (pIndex)
+            return;
+
+        index_allocator indexAlloc(alloc);
+        index_type* pNew = index_traits::allocate(indexAlloc, 1);
+        try
+        {
+            index_traits::construct(indexAlloc, pNew, allocator_type(alloc));
+        }
+        catch (...)
+        {
+            index_traits::deallocate(indexAlloc, pNew, 1);
+            throw;
+        }
+        pIndex = pNew;
+
+        try
+        {
+            for (Link* p = sentinel.pNext; p != &sentinel; p = p->pNext)
+                pIndex->insert(p, &sentinel);
+        }
+        catch (...)
+        {
+            dropIndex();
+            throw;
+        }
+    }
+
+    /*********************************************
+     * LIST :: AT
+     * The element at a position, counting from zero
+     *     INPUT  : the position
+     *     OUTPUT : the element, or std::out_of_range
+     *     COST   : O(log n) with the index, O(n) without
+     *********************************************/
+    template <typename T, typename A>
+    T& list <T, A> ::at(size_t i)
+    {
+        if (i >= numElements)
+            throw std::out_of_range("list::at");
+        return *iterator_at(i);
+    }
+
+    /*********************************************
+     * LIST :: ITERATOR AT
+     * An iterator to the element at a position. Without the
+     * index we walk in from whichever end is nearer.
+     *     INPUT  : the position, size() for end()
+     *     OUTPUT : the iterator, or std::out_of_range
+     *     COST   : O(log n) with the index, O(n) without
+     *********************************************/
+    template <typename T, typename A>
+    typename list <T, A> ::iterator list <T, A> ::iterator_at(size_t i)
+    {
+        if (i > numElements)
+            throw std::out_of_range("list::iterator_at");
+        if (i == numElements)
+            return end();
+        if (pIndex)
+            return iterator(const_cast<Link*>(pIndex->at(i)));
+
+        Link* p;
+        if (i < numElements / 2)
+            for (p = sentinel.pNext; i > 0; i--)
+                p = p->pNext;
+        else
+            for (p = sentinel.pPrev, i = numElements - 1 - i; i > 0; i--)
+                p = p->pPrev;
+        return iterator(p);
+    }
+
+    /*********************************************
+     * LIST :: INDEX OF
+     * The position of the element an iterator refers to
+     *     INPUT  : an iterator into this list
+     *     OUTPUT : its position, size() for end()
+     *     COST   : O(log n) with the index, O(n) without
+     *********************************************/
+    template <typename T, typename A>
+    size_t list <T, A> ::index_of(const iterator& it) const
+    {
+        if (it.p == &sentinel)
+            return numElements;
+        if (pIndex)
+            return pIndex->index_of(it.p);
+
+        size_t i = 0;
+        for (const Link* p = sentinel.pNext; p != it.p; p = p->pNext)
+            i++;
+        return i;
+    }
+
+    /*********************************************
+     * LIST :: ADVANCE
+     * Move an iterator num places forward, or back if num
+     * is negative. It has to land between begin() and end().
+     *     INPUT  : the iterator and how far to move it
+     *     OUTPUT : it, moved
+     *     COST   : O(log n) with the index, O(num) without
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::advance(iterator& it, ptrdiff_t num)
+    {
+        if (pIndex)
+        {
+            it = iterator_at(index_of(it) + static_cast<size_t>(num));
+            return;
+        }
+        for (; num > 0; num--)
+            ++it;
+        for (; num < 0; num++)
+            --it;
+    }
+
+    /*********************************************
+     * LIST :: DROP INDEX
+     * Throw away the positional index, if there is one
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of nodes
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::dropIndex()
+    {
+        if (!pIndex)
+            return;
+        index_allocator indexAlloc(alloc);
+        index_traits::destroy(indexAlloc, pIndex);
+        index_traits::deallocate(indexAlloc, pIndex, 1);
+        pIndex = nullptr;
+    }
+
+    /*********************************************
+     * LIST :: REINDEX
+     * The same nodes are in the list but their order has
+     * changed, so reshape the index to match
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n) with the index, O(1) without
+     *********************************************/
+    template <typename T, typename A>
+    void list <T, A> ::reindex()
+    {
+        if (pIndex)
+            pIndex->rebuild(sentinel.pNext, &sentinel);
+    }
+
+    /**********************************************
+     * SWAP
+     * Trade the contents of two lists, found by ADL so
+     * that std::sort and friends use it
+     *     INPUT  : the two lists
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    void swap(list <T, A>& lhs, list <T, A>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /*********************************************
+     * PARALLEL SORT
+     * Sort a list on every core, std::less by default
+     *     INPUT  : the list and the ordering
+     *     OUTPUT :
+     *     COST   : O(n log n / threads + n) time
+     *********************************************/
+    template <typename T, typename A, class Compare>
+    void parallel_sort(list <T, A>& l, Compare comp)
+    {
+        l.parallel_sort(comp);
+    }
+
+    template <typename T, typename A>
+    void parallel_sort(list <T, A>& l)
+    {
+        l.parallel_sort(std::less<T>());
+    }
+
+    /*********************************************
+     * RADIX SORT
+     * Sort a list by an integral key, or by the elements
+     * themselves when they are integers
+     *     INPUT  : the list and the key of an element
+     *     OUTPUT :
+     *     COST   : O(n * sizeof(key))
+     *********************************************/
+    template <typename T, typename A, class KeyFn>
+    void radix_sort(list <T, A>& l, KeyFn key)
+    {
+        l.radix_sort(key);
+    }
+
+    template <typename T, typename A>
+    void radix_sort(list <T, A>& l)
+    {
+        l.radix_sort();
+    }
+
+    namespace pmr
+    {
+        /*********************************************
+         * PMR LIST
+         * A list whose nodes come from a memory resource,
+         * just like std::pmr::list
+         *********************************************/
+        template <typename T>
+        using list = custom::list <T, std::pmr::polymorphic_allocator<T>>;
+    }
 
     //#endif
 }; // namespace custom
\ No newline at end of file
@@ -0,0 +1,465 @@
+/***********************************************************************
+ * Header:
+ *    PERSISTENT LIST
+ * Summary:
+ *    An immutable singly linked list whose versions share their
+ *    nodes. Copying a list copies one pointer, and every change
+ *    returns a new version that reuses whatever follows the
+ *    change, so a snapshot can be handed to any number of readers
+ *    without copying elements.
+ *
+ *    This will contain the class definition of:
+ *        persistent_list           : a reference-counted, shared list
+ *        persistent_list::iterator : an iterator through the list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstddef>     // for size_t
+#include <atomic>      // for the reference counts
+#include <iterator>    // for std::forward_iterator_tag
+#include <memory>      // for std::allocator
+#include <utility>     // for std::move and std::forward
+
+namespace custom
+{
+
+    /**************************************************
+     * PERSISTENT LIST
+     * A list that never changes once built. Nodes count the
+     * lists and nodes that point at them and are freed when
+     * the last one lets go, so versions may be shared across
+     * threads. push_front and pop_front are O(1); changing
+     * position i copies the i nodes in front of it and shares
+     * the rest.
+     **************************************************/
+    template <typename T, typename A = std::allocator<T>>
+    class persistent_list
+    {
+    public:
+        //
+        // Construct
+        //
+
+        persistent_list() : numElements(0), pHead(nullptr), alloc() { }
+        explicit persistent_list(const A& a) : numElements(0), pHead(nullptr), alloc(a) { }
+        persistent_list(const std::initializer_list<T>& il, const A& a = A());
+        template <class Iterator>
+        persistent_list(Iterator first, Iterator last, const A& a = A());
+        persistent_list(const persistent_list& rhs);
+        persistent_list(persistent_list&& rhs) noexcept;
+        ~persistent_list() { release(pHead); }
+
+        //
+        // Assign
+        //
+
+        persistent_list& operator = (const persistent_list& rhs);
+        persistent_list& operator = (persistent_list&& rhs) noexcept;
+
+        //
+        // Iterator
+        //
+
+        class iterator;
+        iterator begin() const { return iterator(pHead); }
+        iterator end() const { return iterator(nullptr); }
+
+        //
+        // Access
+        //
+
+        const T& front() const { assert(!empty()); return pHead->data; }
+
+        //
+        // New versions - this list is left as it was
+        //
+
+        persistent_list push_front(const T& data) const;
+        persistent_list push_front(T&& data) const;
+        persistent_list pop_front() const;
+        persistent_list set(size_t i, const T& data) const;
+        persistent_list insert(size_t i, const T& data) const;
+        persistent_list erase(size_t i) const;
+
+        //
+        // Status
+        //
+
+        bool empty() const { return numElements == 0; }
+        size_t size() const { return numElements; }
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        // a node is shared by every list and node that points at it
+        struct Node
+        {
+            template <class ... Args>
+            Node(Node* pNext, Args&& ... args) :
+                data(std::forward<Args>(args)...), pNext(pNext), refs(1) { }
+
+            const T data;
+            Node* pNext;                // next node, or nullptr at the end; never changed once shared
+            std::atomic<size_t> refs;   // how many lists and nodes point here
+        };
+
+        using node_allocator = typename std::allocator_traits<A>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+        // a version that takes over a reference to pHead
+        persistent_list(Node* pHead, size_t num, const node_allocator& alloc) :
+            numElements(num), pHead(pHead), alloc(alloc) { }
+
+        // every node is created and let go of through these
+        template <class ... Args>
+        Node* newNode(Node* pNext, Args&& ... args) const;
+        static Node* acquire(Node* p);
+        void release(Node* p) const;
+        Node* copyPrefix(size_t num, Node* pRest) const;
+
+        // member variables
+        size_t numElements;    // though we could count, it is faster to keep a variable
+        Node* pHead;           // first node, nullptr when empty
+        mutable node_allocator alloc; // where the nodes come from, even for a const list
+    };
+
+    /*************************************************
+     * PERSISTENT LIST ITERATOR
+     * Read the elements of a persistent list
+     ************************************************/
+    template <typename T, typename A>
+    class persistent_list <T, A> ::iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() : p(nullptr) { }
+        iterator(const Node* p) : p(p) { }
+
+        bool operator != (const iterator& rhs) const { return rhs.p != p; }
+        bool operator == (const iterator& rhs) const { return rhs.p == p; }
+
+        const T& operator * () const { return p->data; }
+        const T* operator -> () const { return &p->data; }
+
+        iterator& operator ++ () { p = p->pNext; return *this; }
+        iterator operator ++ (int postfix) { iterator it(*this); p = p->pNext; return it; }
+
+        friend class persistent_list <T, A>;
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        const Node* p;
+    };
+
+    /*****************************************
+     * PERSISTENT LIST :: INITIALIZER constructor
+     ****************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> ::persistent_list(const std::initializer_list<T>& il, const A& a) :
+        persistent_list(il.begin(), il.end(), a)
+    {
+    }
+
+    /*****************************************
+     * PERSISTENT LIST :: ITERATOR constructor
+     * Build the nodes front to back. If one fails to
+     * build, the ones before it are let go.
+     ****************************************/
+    template <typename T, typename A>
+    template <class Iterator>
+    persistent_list <T, A> ::persistent_list(Iterator first, Iterator last, const A& a) :
+        numElements(0), pHead(nullptr), alloc(a)
+    {
+        // nobody else can see the nodes yet, so we may still link them
+        Node** ppLink = &pHead;
+        try
+        {
+            for (; first != last; ++first)
+            {
+                *ppLink = newNode(nullptr, *first);
+                ppLink = &(*ppLink)->pNext;
+                numElements++;
+            }
+        }
+        catch (...)
+        {
+            release(pHead);
+            throw;
+        }
+    }
+
+    /*****************************************
+     * PERSISTENT LIST :: COPY constructor
+     * Share the nodes of the RHS
+     ****************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> ::persistent_list(const persistent_list& rhs) :
+        numElements(rhs.numElements), pHead(acquire(rhs.pHead)), alloc(rhs.alloc)
+    {
+    }
+
+    /*****************************************
+     * PERSISTENT LIST :: MOVE constructor
+     * Take over the reference of the RHS
+     ****************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> ::persistent_list(persistent_list&& rhs) noexcept :
+        numElements(rhs.numElements), pHead(rhs.pHead), alloc(std::move(rhs.alloc))
+    {
+        rhs.pHead = nullptr;
+        rhs.numElements = 0;
+    }
+
+    /**********************************************
+     * PERSISTENT LIST :: assignment operator
+     * Share the nodes of the RHS and let go of ours
+     *     INPUT  : a list to be copied
+     *     OUTPUT :
+     *     COST   : O(1), plus O(k) for the nodes nobody else holds
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A>& persistent_list <T, A> :: operator = (const persistent_list& rhs)
+    {
+        // take theirs before letting go of ours, which may be the same
+        Node* pOld = pHead;
+        pHead = acquire(rhs.pHead);
+        numElements = rhs.numElements;
+        release(pOld);
+        alloc = rhs.alloc;
+        return *this;
+    }
+
+    /**********************************************
+     * PERSISTENT LIST :: assignment operator - MOVE
+     *     INPUT  : a list to be moved
+     *     OUTPUT :
+     *     COST   : O(1), plus O(k) for the nodes nobody else holds
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A>& persistent_list <T, A> :: operator = (persistent_list&& rhs) noexcept
+    {
+        if (this == &rhs)
+            return *this;
+
+        release(pHead);
+        pHead = rhs.pHead;
+        numElements = rhs.numElements;
+        alloc = std::move(rhs.alloc);
+        rhs.pHead = nullptr;
+        rhs.numElements = 0;
+        return *this;
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: PUSH FRONT
+     * A version with one more element at the front, sharing
+     * every node of this one
+     *     INPUT  : the new element
+     *     OUTPUT : the new version
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::push_front(const T& data) const
+    {
+        Node* pNew = newNode(acquire(pHead), data);
+        return persistent_list(pNew, numElements + 1, alloc);
+    }
+
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::push_front(T&& data) const
+    {
+        Node* pNew = newNode(acquire(pHead), std::move(data));
+        return persistent_list(pNew, numElements + 1, alloc);
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: POP FRONT
+     * A version without the first element, which is just
+     * the rest of this one
+     *     INPUT  :
+     *     OUTPUT : the new version
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::pop_front() const
+    {
+        if (empty())
+            return *this;
+        return persistent_list(acquire(pHead->pNext), numElements - 1, alloc);
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: SET
+     * A version with a different element at position i.
+     * The nodes in front of it are copied; the ones after
+     * it are shared.
+     *     INPUT  : the position, which must be in range
+     *              the new element
+     *     OUTPUT : the new version
+     *     COST   : O(i)
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::set(size_t i, const T& data) const
+    {
+        assert(i < numElements);
+        const Node* pOld = pHead;
+        for (size_t j = 0; j < i; j++)
+            pOld = pOld->pNext;
+
+        Node* pNew = newNode(acquire(pOld->pNext), data);
+        return persistent_list(copyPrefix(i, pNew), numElements, alloc);
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: INSERT
+     * A version with a new element at position i
+     *     INPUT  : the position, size() for the end
+     *              the new element
+     *     OUTPUT : the new version
+     *     COST   : O(i)
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::insert(size_t i, const T& data) const
+    {
+        assert(i <= numElements);
+        Node* pOld = pHead;
+        for (size_t j = 0; j < i; j++)
+            pOld = pOld->pNext;
+
+        Node* pNew = newNode(acquire(pOld), data);
+        return persistent_list(copyPrefix(i, pNew), numElements + 1, alloc);
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: ERASE
+     * A version without the element at position i
+     *     INPUT  : the position, which must be in range
+     *     OUTPUT : the new version
+     *     COST   : O(i)
+     *********************************************/
+    template <typename T, typename A>
+    persistent_list <T, A> persistent_list <T, A> ::erase(size_t i) const
+    {
+        assert(i < numElements);
+        const Node* pOld = pHead;
+        for (size_t j = 0; j < i; j++)
+            pOld = pOld->pNext;
+
+        return persistent_list(copyPrefix(i, acquire(pOld->pNext)), numElements - 1, alloc);
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: NEW NODE
+     * Build a node through the allocator. It takes over
+     * the reference to pNext, and lets go of it if the
+     * element fails to build.
+     *     INPUT  : the node after it, already acquired
+     *              arguments for the element
+     *     OUTPUT : the new node, referenced once
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    template <class ... Args>
+    typename persistent_list <T, A> ::Node* persistent_list <T, A> ::newNode(Node* pNext, Args&& ... args) const
+    {
+        Node* pNew = nullptr;
+        try
+        {
+            pNew = node_traits::allocate(alloc, 1);
+            node_traits::construct(alloc, pNew, pNext, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            if (pNew)
+                node_traits::deallocate(alloc, pNew, 1);
+            release(pNext);
+            throw;
+        }
+        return pNew;
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: ACQUIRE
+     * Count one more pointer to a node
+     *     INPUT  : the node, or nullptr
+     *     OUTPUT : the same node
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, typename A>
+    typename persistent_list <T, A> ::Node* persistent_list <T, A> ::acquire(Node* p)
+    {
+        if (p)
+            p->refs.fetch_add(1, std::memory_order_relaxed);
+        return p;
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: RELEASE
+     * Count one less pointer to a node. The last one to let
+     * go frees it and lets go of the node after it, in a
+     * loop rather than recursion so long lists are safe.
+     *     INPUT  : the node, or nullptr
+     *     OUTPUT :
+     *     COST   : O(k) with respect to the nodes nobody else holds
+     *********************************************/
+    template <typename T, typename A>
+    void persistent_list <T, A> ::release(Node* p) const
+    {
+        while (p && p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Node* pNext = p->pNext;
+            node_traits::destroy(alloc, p);
+            node_traits::deallocate(alloc, p, 1);
+            p = pNext;
+        }
+    }
+
+    /*********************************************
+     * PERSISTENT LIST :: COPY PREFIX
+     * Copy our first num nodes into a new chain that ends
+     * in pRest. The chain takes over the reference to pRest;
+     * if a copy fails, the chain and pRest are let go.
+     *     INPUT  : how many nodes to copy
+     *              what the copies lead to, already acquired
+     *     OUTPUT : the first node of the chain
+     *     COST   : O(num)
+     *********************************************/
+    template <typename T, typename A>
+    typename persistent_list <T, A> ::Node* persistent_list <T, A> ::copyPrefix(size_t num, Node* pRest) const
+    {
+        // nobody else can see the copies yet, so we may still link them
+        Node* pFirst = nullptr;
+        Node** ppLink = &pFirst;
+        const Node* pOld = pHead;
+        try
+        {
+            for (size_t i = 0; i < num; i++, pOld = pOld->pNext)
+            {
+                *ppLink = newNode(nullptr, pOld->data);
+                ppLink = &(*ppLink)->pNext;
+            }
+        }
+        catch (...)
+        {
+            *ppLink = pRest;
+            release(pFirst);
+            throw;
+        }
+        *ppLink = pRest;
+        return pFirst;
+    }
+
+}; // namespace custom
@@ -0,0 +1,351 @@
+/***********************************************************************
+ * Header:
+ *    TEST COMPACT LIST
+ * Summary:
+ *    Unit tests for compact_list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "compact_list.h"
+#include "unitTest.h"
+
+#include <memory>
+#include <string>
+
+class TestCompactList : public UnitTest
+{
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructInit_standard();
+      test_constructCopy_standard();
+      test_constructMove_standard();
+      test_node_size();
+
+      // Insert
+      test_pushback_empty();
+      test_pushfront_standard();
+      test_insert_standardMiddle();
+      test_insert_grow();
+      test_insert_growSelf();
+
+      // Remove
+      test_erase_standardMiddle();
+      test_erase_reuseSlot();
+      test_popback_standard();
+      test_clear_standard();
+
+      // Split layout
+      test_split_nodeSize();
+      test_split_standard();
+      test_split_grow();
+      test_split_eraseMove();
+
+      report("CompactList");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // default constructor, no allocations
+   void test_construct_default()
+   {  // exercise
+      custom::compact_list<int> l;
+      // verify
+      assertUnit(l.nodes == nullptr);
+      assertUnit(l.capacity == 0);
+      assertUnit(l.empty());
+      assertUnit(l.begin() == l.end());
+   }  // teardown
+
+   // the standard fixture lands in slots 1, 2, 3
+   void test_constructInit_standard()
+   {  // exercise
+      custom::compact_list<int> l{ 11, 26, 31 };
+      // verify
+      assertStandardFixture(l);
+      assertUnit(l.nodes[0].next == 1);
+      assertUnit(l.nodes[1].next == 2);
+      assertUnit(l.nodes[2].next == 3);
+      assertUnit(l.nodes[3].next == 0);
+      assertUnit(l.nodes[0].prev == 3);
+   }  // teardown
+
+   // a copy has its own slab
+   void test_constructCopy_standard()
+   {  // setup
+      custom::compact_list<int> lSrc{ 11, 26, 31 };
+      // exercise
+      custom::compact_list<int> lDest(lSrc);
+      // verify
+      assertUnit(lSrc.nodes != lDest.nodes);
+      assertStandardFixture(lSrc);
+      assertStandardFixture(lDest);
+   }  // teardown
+
+   // a move takes the slab
+   void test_constructMove_standard()
+   {  // setup
+      custom::compact_list<int> lSrc{ 11, 26, 31 };
+      custom::compact_list<int>::Node* p = lSrc.nodes;
+      // exercise
+      custom::compact_list<int> lDest(std::move(lSrc));
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(lSrc.nodes == nullptr);
+      assertUnit(lDest.nodes == p);
+      assertStandardFixture(lDest);
+   }  // teardown
+
+   // two 32-bit links and the payload
+   void test_node_size()
+   {  // verify
+      assertUnit(sizeof(custom::compact_list<int>::Node) == 12);
+      assertUnit(sizeof(custom::compact_list<double>::Node) == 16);
+   }
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // push back onto an empty list makes the slab
+   void test_pushback_empty()
+   {  // setup
+      custom::compact_list<int> l;
+      // exercise
+      l.push_back(int(99));
+      // verify
+      assertUnit(l.size() == 1);
+      assertUnit(l.capacity >= 2);
+      assertUnit(l.front() == 99);
+      assertUnit(l.back() == 99);
+      assertUnit(l.nodes[0].next == l.nodes[0].prev);
+   }  // teardown
+
+   // push front onto the standard fixture
+   void test_pushfront_standard()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31 };
+      // exercise
+      l.push_front(int(99));
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(l.front() == 99);
+      assertUnit(l.back() == 31);
+      assertUnit(*++l.begin() == 11);
+   }  // teardown
+
+   // insert in the middle of the standard fixture
+   void test_insert_standardMiddle()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31 };
+      custom::compact_list<int>::iterator it = l.begin();
+      ++it;
+      // exercise
+      it = l.insert(it, int(99));
+      // verify
+      assertUnit(*it == 99);
+      assertUnit(l.size() == 4);
+      int expected[] = { 11, 99, 26, 31 };
+      int i = 0;
+      for (custom::compact_list<int>::iterator itCheck = l.begin(); itCheck != l.end(); ++itCheck)
+         assertUnit(*itCheck == expected[i++]);
+      assertUnit(i == 4);
+   }  // teardown
+
+   // iterators survive the slab moving
+   void test_insert_grow()
+   {  // setup
+      custom::compact_list<std::string> l;
+      l.push_back(std::string("eleven"));
+      custom::compact_list<std::string>::iterator it = l.begin();
+      custom::compact_list<std::string>::Node* p = l.nodes;
+      // exercise
+      for (int i = 0; i < 100; i++)
+         l.push_back(std::string("filler"));
+      // verify
+      assertUnit(l.nodes != p);
+      assertUnit(*it == std::string("eleven"));
+      assertUnit(l.size() == 101);
+   }  // teardown
+
+   // an element of the list itself is copied before the slab moves
+   void test_insert_growSelf()
+   {  // setup
+      custom::compact_list<std::string> l;
+      l.push_back(std::string("eleven"));
+      // exercise
+      for (int i = 0; i < 60; i++)
+         l.push_back(l.front());
+      // verify
+      assertUnit(l.size() == 61);
+      int i = 0;
+      for (custom::compact_list<std::string>::iterator it = l.begin(); it != l.end(); ++it)
+         i += (*it == std::string("eleven"));
+      assertUnit(i == 61);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // erase from the middle of the standard fixture
+   void test_erase_standardMiddle()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31 };
+      custom::compact_list<int>::iterator it = l.begin();
+      ++it;
+      // exercise
+      it = l.erase(it);
+      // verify
+      assertUnit(*it == 31);
+      assertUnit(l.size() == 2);
+      assertUnit(l.nodes[1].next == 3);
+      assertUnit(l.nodes[3].prev == 1);
+      assertUnit(l.nodes[2].prev == l.freeSlot);
+      assertUnit(l.freeHead == 2);
+   }  // teardown
+
+   // a freed slot is the next one used
+   void test_erase_reuseSlot()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31 };
+      custom::compact_list<int>::iterator it = l.begin();
+      ++it;
+      l.erase(it);
+      // exercise
+      it = l.insert(l.end(), int(99));
+      // verify
+      assertUnit(it.i == 2);
+      assertUnit(l.freeHead == 0);
+      assertUnit(l.back() == 99);
+      assertUnit(l.size() == 3);
+   }  // teardown
+
+   // pop the back of the standard fixture
+   void test_popback_standard()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31, 99 };
+      // exercise
+      l.pop_back();
+      // verify
+      assertStandardFixture(l);
+   }  // teardown
+
+   // clear keeps the slab but empties the list
+   void test_clear_standard()
+   {  // setup
+      custom::compact_list<int> l{ 11, 26, 31 };
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.begin() == l.end());
+      assertUnit(l.capacity > 0);
+      assertUnit(l.used == 1);
+   }  // teardown
+
+   /***************************************
+    * SPLIT LAYOUT
+    ***************************************/
+
+   using SplitList = custom::compact_list<std::string, std::allocator<std::string>, custom::split_layout>;
+
+   // the link slab holds only the two indices
+   void test_split_nodeSize()
+   {  // verify
+      assertUnit(sizeof(SplitList::Node) == 8);
+      assertUnit(sizeof(custom::compact_list<double, std::allocator<double>, custom::split_layout>::Node) == 8);
+   }
+
+   // the standard fixture, with the payloads off to the side
+   void test_split_standard()
+   {  // exercise
+      SplitList l{ "11", "26", "31" };
+      // verify
+      assertUnit(l.size() == 3);
+      assertUnit(l.payloads != nullptr);
+      assertUnit(l.nodes[0].next == 1);
+      assertUnit(l.nodes[1].next == 2);
+      assertUnit(l.nodes[2].next == 3);
+      assertUnit(l.nodes[3].next == 0);
+      assertUnit(l.payloads[1].value() == std::string("11"));
+      assertUnit(l.payloads[2].value() == std::string("26"));
+      assertUnit(l.payloads[3].value() == std::string("31"));
+      assertUnit(l.front() == std::string("11"));
+      assertUnit(l.back() == std::string("31"));
+   }  // teardown
+
+   // both slabs move together and iterators survive
+   void test_split_grow()
+   {  // setup
+      SplitList l;
+      l.push_back(std::string("eleven"));
+      SplitList::iterator it = l.begin();
+      SplitList::Payload* p = l.payloads;
+      // exercise
+      for (int i = 0; i < 100; i++)
+         l.push_back(std::string("filler"));
+      // verify
+      assertUnit(l.payloads != p);
+      assertUnit(*it == std::string("eleven"));
+      assertUnit(l.size() == 101);
+   }  // teardown
+
+   // erase relinks without touching the other payloads, and a move takes both slabs
+   void test_split_eraseMove()
+   {  // setup
+      SplitList lSrc{ "11", "26", "31" };
+      SplitList::iterator it = lSrc.begin();
+      ++it;
+      lSrc.erase(it);
+      SplitList::Payload* p = lSrc.payloads;
+      // exercise
+      SplitList lDest(std::move(lSrc));
+      // verify
+      assertUnit(lSrc.payloads == nullptr);
+      assertUnit(lDest.payloads == p);
+      assertUnit(lDest.nodes[1].next == 3);
+      assertUnit(lDest.nodes[2].prev == lDest.freeSlot);
+      assertUnit(lDest.front() == std::string("11"));
+      assertUnit(lDest.back() == std::string("31"));
+   }  // teardown
+
+   /****************************************************************
+    * Verify Standard Fixture
+    *       +----+   +----+   +----+
+    *       | 11 | - | 26 | - | 31 |
+    *       +----+   +----+   +----+
+    ****************************************************************/
+   void assertStandardFixtureParameters(custom::compact_list<int>& l, int line, const char* function)
+   {
+      assertIndirect(l.numElements == 3);
+      assertIndirect(l.nodes != nullptr);
+      if (l.nodes == nullptr)
+         return;
+
+      custom::compact_list<int>::index i1 = l.nodes[0].next;
+      custom::compact_list<int>::index i2 = l.nodes[i1].next;
+      custom::compact_list<int>::index i3 = l.nodes[i2].next;
+      assertIndirect(l.nodes[i1].value() == 11);
+      assertIndirect(l.nodes[i2].value() == 26);
+      assertIndirect(l.nodes[i3].value() == 31);
+      assertIndirect(l.nodes[i3].next == 0);
+      assertIndirect(l.nodes[0].prev == i3);
+      assertIndirect(l.nodes[i3].prev == i2);
+      assertIndirect(l.nodes[i2].prev == i1);
+      assertIndirect(l.nodes[i1].prev == 0);
+   }
+};
+
+#endif // DEBUG
@@ -0,0 +1,323 @@
+/***********************************************************************
+ * Header:
+ *    TEST INTRUSIVE LIST
+ * Summary:
+ *    Unit tests for intrusive_list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "intrusive_list.h"
+#include "unitTest.h"
+
+#include <memory>
+#include <string>
+
+class TestIntrusiveList : public UnitTest
+{
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructMove_standard();
+
+      // Insert
+      test_pushback_standard();
+      test_pushfront_standard();
+      test_insert_standardMiddle();
+      test_insert_noAllocation();
+
+      // Remove
+      test_popback_standard();
+      test_popfront_empty();
+      test_erase_byReference();
+      test_clear_standard();
+      test_autoUnlink_destroy();
+
+      // Iterator
+      test_iterator_walk();
+      test_iterator_hookDeepInside();
+
+      report("IntrusiveList");
+   }
+
+   // an element that can sit in an intrusive list
+   struct Item
+   {
+      Item(int data) : data(data) { }
+      int data;
+      custom::list_hook hook;
+   };
+   using ItemList = custom::intrusive_list<Item, &Item::hook>;
+
+   // an element that leaves its list when it is destroyed
+   struct AutoItem
+   {
+      AutoItem(int data) : data(data) { }
+      int data;
+      custom::auto_unlink_hook hook;
+   };
+   using AutoItemList = custom::intrusive_list<AutoItem, &AutoItem::hook>;
+
+   // an element with two hooks, neither of them first
+   struct Record
+   {
+      Record(const std::string& name, double weight) : name(name), weight(weight) { }
+      std::string name;
+      custom::list_hook byName;
+      double weight;
+      custom::list_hook byWeight;
+   };
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // an empty list points its sentinel at itself
+   void test_construct_default()
+   {  // exercise
+      ItemList l;
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.size() == 0);
+      assertUnit(l.begin() == l.end());
+      assertUnit(l.sentinel.pNext == &l.sentinel);
+      assertUnit(l.sentinel.pPrev == &l.sentinel);
+   }  // teardown
+
+   // moving re-points the end elements at the new sentinel
+   void test_constructMove_standard()
+   {  // setup
+      Item i11(11), i26(26), i31(31);
+      ItemList lSrc;
+      setupStandardFixture(lSrc, i11, i26, i31);
+      // exercise
+      ItemList lDest(std::move(lSrc));
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(lDest.size() == 3);
+      assertUnit(lDest.sentinel.pNext == &i11.hook);
+      assertUnit(lDest.sentinel.pPrev == &i31.hook);
+      assertUnit(i11.hook.pNext == &i26.hook);
+      assertUnit(i26.hook.pNext == &i31.hook);
+      assertUnit(i11.hook.pPrev == &lDest.sentinel);
+      assertUnit(i31.hook.pNext == &lDest.sentinel);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // push onto the back of the standard fixture
+   void test_pushback_standard()
+   {  // setup
+      Item i11(11), i26(26), i31(31), i99(99);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      l.push_back(i99);
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(&l.back() == &i99);
+      assertUnit(i31.hook.pNext == &i99.hook);
+      assertUnit(i99.hook.pPrev == &i31.hook);
+      assertUnit(i99.hook.pNext == &l.sentinel);
+   }  // teardown
+
+   // push onto the front of the standard fixture
+   void test_pushfront_standard()
+   {  // setup
+      Item i11(11), i26(26), i31(31), i99(99);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      l.push_front(i99);
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(&l.front() == &i99);
+      assertUnit(i11.hook.pPrev == &i99.hook);
+      assertUnit(i99.hook.pNext == &i11.hook);
+      assertUnit(i99.hook.pPrev == &l.sentinel);
+   }  // teardown
+
+   // insert into the middle of the standard fixture
+   void test_insert_standardMiddle()
+   {  // setup
+      Item i11(11), i26(26), i31(31), i99(99);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      ItemList::iterator it = l.insert(l.iterator_to(i26), i99);
+      // verify
+      assertUnit(&*it == &i99);
+      assertUnit(l.size() == 4);
+      assertUnit(i11.hook.pNext == &i99.hook);
+      assertUnit(i99.hook.pNext == &i26.hook);
+      assertUnit(i26.hook.pPrev == &i99.hook);
+   }  // teardown
+
+   // linking an element allocates nothing, the links are in the element
+   void test_insert_noAllocation()
+   {  // setup
+      std::unique_ptr<Item> p(new Item(42));
+      ItemList l;
+      // exercise
+      l.push_back(*p);
+      // verify
+      assertUnit(&l.front() == p.get());
+      assertUnit(l.front().data == 42);
+      assertUnit(p->hook.is_linked());
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // pop the back of the standard fixture
+   void test_popback_standard()
+   {  // setup
+      Item i11(11), i26(26), i31(31);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      l.pop_back();
+      // verify
+      assertUnit(l.size() == 2);
+      assertUnit(&l.back() == &i26);
+      assertUnit(!i31.hook.is_linked());
+      assertUnit(i31.data == 31);
+   }  // teardown
+
+   // popping an empty list does nothing
+   void test_popfront_empty()
+   {  // setup
+      ItemList l;
+      // exercise
+      l.pop_front();
+      // verify
+      assertUnit(l.empty());
+   }  // teardown
+
+   // erase straight from the element, no search
+   void test_erase_byReference()
+   {  // setup
+      Item i11(11), i26(26), i31(31);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      ItemList::iterator it = l.erase(i26);
+      // verify
+      assertUnit(&*it == &i31);
+      assertUnit(l.size() == 2);
+      assertUnit(i11.hook.pNext == &i31.hook);
+      assertUnit(i31.hook.pPrev == &i11.hook);
+      assertUnit(!i26.hook.is_linked());
+   }  // teardown
+
+   // clear leaves every element unlinked
+   void test_clear_standard()
+   {  // setup
+      Item i11(11), i26(26), i31(31);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(!i11.hook.is_linked());
+      assertUnit(!i26.hook.is_linked());
+      assertUnit(!i31.hook.is_linked());
+   }  // teardown
+
+   // an auto-unlink element takes itself out when it dies
+   void test_autoUnlink_destroy()
+   {  // setup
+      AutoItem i11(11), i31(31);
+      AutoItemList l;
+      l.push_back(i11);
+      {
+         AutoItem i26(26);
+         l.push_back(i31);
+         l.insert(l.iterator_to(i31), i26);
+         assertUnit(l.size() == 3);
+      } // exercise
+      // verify
+      assertUnit(l.size() == 2);
+      assertUnit(&l.front() == &i11);
+      assertUnit(&l.back() == &i31);
+      assertUnit(i11.hook.pNext == &i31.hook);
+   }  // teardown
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // walk forward and back through the standard fixture
+   void test_iterator_walk()
+   {  // setup
+      Item i11(11), i26(26), i31(31);
+      ItemList l;
+      setupStandardFixture(l, i11, i26, i31);
+      int sum = 0;
+      // exercise
+      for (ItemList::iterator it = l.begin(); it != l.end(); ++it)
+         sum += it->data;
+      ItemList::iterator it = l.end();
+      --it;
+      // verify
+      assertUnit(sum == 11 + 26 + 31);
+      assertUnit(&*it == &i31);
+      --it;
+      assertUnit(&*it == &i26);
+   }  // teardown
+
+   // each hook finds its own element, wherever it sits in the element
+   void test_iterator_hookDeepInside()
+   {  // setup
+      Record a("a", 1.5), b("b", 2.5);
+      custom::intrusive_list<Record, &Record::byName> lName;
+      custom::intrusive_list<Record, &Record::byWeight> lWeight;
+      // exercise
+      lName.push_back(a);
+      lName.push_back(b);
+      lWeight.push_back(b);
+      lWeight.push_back(a);
+      // verify
+      assertUnit(&lName.front() == &a);
+      assertUnit(&lName.back() == &b);
+      assertUnit(&lWeight.front() == &b);
+      assertUnit(&lWeight.back() == &a);
+      assertUnit(lName.begin()->name == "a");
+      assertUnit(lWeight.begin()->weight == 2.5);
+      lName.clear();
+      lWeight.clear();
+   }  // teardown
+
+   /****************************************************************
+    * Setup Standard Fixture
+    *       +----+   +----+   +----+
+    *       | 11 | - | 26 | - | 31 |
+    *       +----+   +----+   +----+
+    ****************************************************************/
+   void setupStandardFixture(ItemList& l, Item& i11, Item& i26, Item& i31)
+   {
+      l.sentinel.pNext = &i11.hook;
+      i11.hook.pPrev = &l.sentinel;
+      i11.hook.pNext = &i26.hook;
+      i26.hook.pPrev = &i11.hook;
+      i26.hook.pNext = &i31.hook;
+      i31.hook.pPrev = &i26.hook;
+      i31.hook.pNext = &l.sentinel;
+      l.sentinel.pPrev = &i31.hook;
+      l.numElements = 3;
+   }
+};
+
+#endif // DEBUG
@@ -12,6 +12,39 @@
 #endif // DEBUG
 
 #include "testList.h"       // for the spy unit tests
+#include "testIntrusiveList.h"
+#include "testCompactList.h"
+#include "testUnrolledList.h"
+#include "testPersistentList.h"
+#include <cstdlib>          // for MALLOC and FREE
+#include <new>              // for BAD_ALLOC
+
+#ifdef DEBUG
+/**********************************************************************
+ * GLOBAL OPERATOR NEW and DELETE
+ * Replaced once for the whole test program so GlobalHeap can count
+ * every call
+ ***********************************************************************/
+void* operator new(size_t size)
+{
+   GlobalHeap::calls++;
+   if (void* p = std::malloc(size ? size : 1))
+      return p;
+   throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+   if (p)
+      GlobalHeap::calls++;
+   std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+   operator delete(p);
+}
+#endif // DEBUG
 
 
 /**********************************************************************
@@ -23,6 +56,10 @@ int main()
 #ifdef DEBUG
    // unit tests
    TestList().run();
+   TestIntrusiveList().run();
+   TestCompactList().run();
+   TestUnrolledList().run();
+   TestPersistentList().run();
 #endif // DEBUG
    
    return 0;
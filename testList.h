@@ -16,9 +16,143 @@
 #include "unitTest.h"
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <iostream>
+#include <thread>
+#include <memory_resource>
+#include <sstream>
+#include <iterator>
+#include <atomic>
+
+/***********************************************************************
+ * COUNTING ALLOCATOR
+ * A stateful allocator that keeps a tally of the live allocations
+ * made through it, so the tests can watch every node come and go
+ ************************************************************************/
+template <class T>
+struct CountingAllocator
+{
+   using value_type = T;
+
+   CountingAllocator(int* pLive) : pLive(pLive) {}
+   template <class U>
+   CountingAllocator(const CountingAllocator<U>& rhs) : pLive(rhs.pLive) {}
+
+   T* allocate(size_t n)
+   {
+      ++*pLive;
+      return std::allocator<T>().allocate(n);
+   }
+   void deallocate(T* p, size_t n)
+   {
+      --*pLive;
+      std::allocator<T>().deallocate(p, n);
+   }
+
+   bool operator == (const CountingAllocator& rhs) const { return pLive == rhs.pLive; }
+   bool operator != (const CountingAllocator& rhs) const { return pLive != rhs.pLive; }
+
+   int* pLive;   // shared count of allocations not yet given back
+};
+
+/***********************************************************************
+ * PROPAGATING ALLOCATOR
+ * A counting allocator that follows the list it is assigned from,
+ * so the tests can see which allocator frees what
+ ************************************************************************/
+template <class T>
+struct PropagatingAllocator : CountingAllocator<T>
+{
+   using propagate_on_container_copy_assignment = std::true_type;
+   using propagate_on_container_move_assignment = std::true_type;
+   using propagate_on_container_swap = std::true_type;
+
+   PropagatingAllocator(int* pLive) : CountingAllocator<T>(pLive) {}
+   template <class U>
+   PropagatingAllocator(const PropagatingAllocator<U>& rhs) : CountingAllocator<T>(rhs.pLive) {}
+};
+
+/***********************************************************************
+ * STATELESS ALLOCATOR
+ * An always-equal allocator that counts its live allocations in one
+ * shared tally. Lists over it free their nodes straight away, since
+ * it has not opted in to the node cache.
+ ************************************************************************/
+struct StatelessHeap
+{
+   inline static std::atomic<int> live{ 0 };
+};
+
+template <class T>
+struct StatelessAllocator
+{
+   using value_type = T;
+
+   StatelessAllocator() = default;
+   template <class U>
+   StatelessAllocator(const StatelessAllocator<U>&) {}
+
+   T* allocate(size_t n)
+   {
+      StatelessHeap::live++;
+      return std::allocator<T>().allocate(n);
+   }
+   void deallocate(T* p, size_t n)
+   {
+      StatelessHeap::live--;
+      std::allocator<T>().deallocate(p, n);
+   }
+
+   bool operator == (const StatelessAllocator&) const { return true; }
+   bool operator != (const StatelessAllocator&) const { return false; }
+};
+
+/***********************************************************************
+ * CACHED ALLOCATOR
+ * The same allocator, opted in to the node cache
+ ************************************************************************/
+template <class T>
+struct CachedAllocator : StatelessAllocator<T>
+{
+   CachedAllocator() = default;
+   template <class U>
+   CachedAllocator(const CachedAllocator<U>&) {}
+};
+
+namespace custom
+{
+   template <class T>
+   struct uses_node_cache <CachedAllocator<T>> : std::true_type { };
+}
+
+/***********************************************************************
+ * GLOBAL HEAP
+ * Every trip through the global operator new or delete is counted,
+ * so a test can show that a workload never went near the heap. The
+ * replacement operators that do the counting live in testList.cpp.
+ ************************************************************************/
+struct GlobalHeap
+{
+   inline static std::atomic<size_t> calls{ 0 };
+};
+
+/***********************************************************************
+ * TALLY
+ * Two numbers that count how many times any Tally has been copied
+ * or moved, so the tests can tell whether one was built in place
+ ************************************************************************/
+struct Tally
+{
+   Tally(int a, int b) : a(a), b(b) { }
+   Tally(const Tally& rhs) : a(rhs.a), b(rhs.b) { transfers++; }
+   Tally(Tally&& rhs) : a(rhs.a), b(rhs.b) { transfers++; }
+
+   int a;
+   int b;
+   inline static int transfers = 0;
+};
 
 class TestList : public UnitTest
 {
@@ -61,6 +195,11 @@ public:
       test_iterator_increment_standardMiddle();
       test_iterator_dereference_read();
       test_iterator_dereference_update();
+      test_iterator_increment_tailToEnd();
+      test_iterator_decrement_end();
+      test_iterator_postfix_standard();
+      test_iterator_reverse_standard();
+      test_iterator_reverse_empty();
 
       // Access
       test_front_empty();
@@ -94,6 +233,9 @@ public:
       test_popback_standard();
       test_popfront_empty();
       test_popfront_standard();
+      test_popback_single();
+      test_popfront_single();
+      test_pop_queueReclaims();
       test_erase_empty();
       test_erase_standardFront();
       test_erase_standardMiddle();
@@ -104,6 +246,103 @@ public:
       test_size_three();
       test_empty_empty();
       test_empty_three();
+
+      // Allocator
+      test_allocator_pushErase();
+      test_allocator_fill();
+      test_allocator_copy();
+      test_allocator_moveUnequal();
+      // Recycling
+      test_recycle_offByDefault();
+      test_recycle_reuse();
+      test_recycle_highWater();
+      test_recycle_release();
+      // Bulk construction
+      test_block_fillContiguous();
+      test_block_rangeContiguous();
+      test_block_eraseHoles();
+      // Thread node cache
+      test_threadCache_shared();
+      test_threadCache_bounded();
+      test_threadCache_depot();
+      test_threadCache_optIn();
+      test_threadCache_outlived();
+      // Memory resource
+      test_pmr_requestScoped();
+      test_pmr_assign();
+      test_pmr_moveBetweenResources();
+      // Emplace
+      test_emplace_standardMiddle();
+      test_emplaceBack_noCopies();
+      test_emplaceFront_empty();
+      test_emplace_moveOnly();
+      // Swap
+      test_swap_standardEmpty();
+      test_swap_adl();
+      test_swap_blocks();
+      test_move_noexcept();
+      // Sort
+      test_sort_empty();
+      test_sort_standardReversed();
+      test_sort_compare();
+      test_sort_stable();
+      test_sort_large();
+      test_sort_throw();
+      test_parallelSort_small();
+      test_parallelSort_large();
+      test_parallelSort_oddRuns();
+      test_parallelSort_throw();
+      test_radixSort_unsigned();
+      test_radixSort_signed();
+      test_radixSort_key();
+      test_radixSort_throw();
+      test_splice_all();
+      test_splice_allEmpty();
+      test_splice_one();
+      test_splice_oneSelf();
+      test_splice_range();
+      test_splice_rangeSelf();
+      test_splice_blocks();
+      test_splice_manyBlocks();
+      test_merge_interleave();
+      test_merge_empty();
+      test_merge_compareRvalue();
+      test_merge_stable();
+      test_merge_throw();
+      test_remove_value();
+      test_remove_ownElement();
+      test_removeIf_released();
+      test_removeIf_throw();
+      test_unique_default();
+      test_unique_predicate();
+      test_reverse_standard();
+      test_reverse_emptyOne();
+      test_insert_fill();
+      test_insert_range();
+      test_insert_initializer();
+      test_insert_inputRange();
+      test_insert_rangeThrow();
+      test_erase_rangeMiddle();
+      test_erase_rangeAll();
+      test_erase_rangeEmpty();
+      test_erase_rangeRecycled();
+      test_index_walk();
+      test_index_outOfRange();
+      test_index_insertErase();
+      test_index_reorder();
+      test_index_bulk();
+      test_index_splice();
+      test_index_merge();
+      test_index_moveSwap();
+      test_index_assignAllocator();
+      test_compact_churned();
+      test_compact_empty();
+      test_compact_moveOnly();
+      test_compact_incremental();
+      test_compact_grown();
+      test_compact_midList();
+      test_compact_threadCache();
+      test_compact_index();
       
       report("List");
    }
@@ -139,28 +378,26 @@ public:
       //    | 00 | - | 00 | - | 00 |
       //    +----+   +----+   +----+      
       assertUnit(l.numElements == 3);
-      assertUnit(l.pHead != nullptr);
-      if (l.pHead)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int());
-         assertUnit(l.pHead->pPrev == nullptr);
-         assertUnit(l.pHead->pNext != nullptr);
-         if (l.pHead->pNext != nullptr)
+         assertUnit(l.sentinel.pNext->node()->data == int());
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int());
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            if (l.pHead->pNext->pNext != nullptr)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int());
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int());
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == nullptr);
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int());
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == &l.sentinel);
             }
          }
       }
-      // teardown
-      teardownStandardFixture(l);
-   }
+   }  // teardown - the nodes share one block, so the list frees them
 
    // construct with a size of three and fill
    void test_construct_sizeThreeFill()
@@ -173,28 +410,26 @@ public:
       //    | 99 | - | 99 | - | 99 |
       //    +----+   +----+   +----+      
       assertUnit(l.numElements == 3);
-      assertUnit(l.pHead != nullptr);
-      if (l.pHead)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pPrev == nullptr);
-         assertUnit(l.pHead->pNext != nullptr);
-         if (l.pHead->pNext != nullptr)
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(99));
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            if (l.pHead->pNext->pNext != nullptr)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(99));
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(99));
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == nullptr);
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(99));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == &l.sentinel);
             }
          }
       }
-      // teardown
-      teardownStandardFixture(l);
-   }
+   }  // teardown
 
    /***************************************
     * DESTRUCTOR
@@ -250,12 +485,12 @@ public:
       // exercise
       custom::list<int> lDest(lSrc);
       // verify
-      assertUnit(lSrc.pHead != lDest.pHead);
-      if (lSrc.pHead && lDest.pHead)
+      assertUnit(lSrc.sentinel.pNext != lDest.sentinel.pNext);
+      if (lSrc.sentinel.pNext != &lSrc.sentinel && lDest.sentinel.pNext != &lDest.sentinel)
       {
-         assertUnit(lSrc.pHead->pNext != lDest.pHead->pNext);
-         if (lSrc.pHead->pNext && lDest.pHead->pNext)
-            assertUnit(lSrc.pHead->pNext->pNext != lDest.pHead->pNext->pNext);
+         assertUnit(lSrc.sentinel.pNext->pNext != lDest.sentinel.pNext->pNext);
+         if (lSrc.sentinel.pNext->pNext != &lSrc.sentinel && lDest.sentinel.pNext->pNext != &lDest.sentinel)
+            assertUnit(lSrc.sentinel.pNext->pNext->pNext != lDest.sentinel.pNext->pNext->pNext);
       }
       //    +----+   +----+   +----+
       //    | 11 | - | 26 | - | 31 |
@@ -293,7 +528,7 @@ public:
       //    +----+   +----+   +----+      
       custom::list<int> lSrc;
       setupStandardFixture(lSrc);
-      custom::list<int>::Node *p = lSrc.pHead;
+      custom::list<int>::Link* p = lSrc.sentinel.pNext;
       // exercise
       custom::list<int> lDest(std::move(lSrc));
       // verify
@@ -302,7 +537,7 @@ public:
       //    | 11 | - | 26 | - | 31 |
       //    +----+   +----+   +----+      
       assertStandardFixture(lDest);
-      assertUnit(p == lDest.pHead);
+      assertUnit(p == lDest.sentinel.pNext);
       // teardown
       teardownStandardFixture(lSrc);
       teardownStandardFixture(lDest);
@@ -361,9 +596,7 @@ public:
       //    | 11 | - | 26 | - | 31 |
       //    +----+   +----+   +----+      
       assertStandardFixture(l);
-      // teardown
-      teardownStandardFixture(l);
-   }
+   }  // teardown
 
 
    /***************************************
@@ -456,12 +689,12 @@ public:
       // exercise
       lDes = lSrc;
       // verify
-      assertUnit(lSrc.pHead != lDes.pHead);
-      if (lSrc.pHead && lDes.pHead)
+      assertUnit(lSrc.sentinel.pNext != lDes.sentinel.pNext);
+      if (lSrc.sentinel.pNext != &lSrc.sentinel && lDes.sentinel.pNext != &lDes.sentinel)
       {
-         assertUnit(lSrc.pHead->pNext != lDes.pHead->pNext);
-         if (lSrc.pHead->pNext && lDes.pHead->pNext)
-            assertUnit(lSrc.pHead->pNext->pNext != lDes.pHead->pNext->pNext);
+         assertUnit(lSrc.sentinel.pNext->pNext != lDes.sentinel.pNext->pNext);
+         if (lSrc.sentinel.pNext->pNext != &lSrc.sentinel && lDes.sentinel.pNext->pNext != &lDes.sentinel)
+            assertUnit(lSrc.sentinel.pNext->pNext->pNext != lDes.sentinel.pNext->pNext->pNext);
       } 
       // lSrc   pHead             pTail
       //       +----+   +----+   +----+
@@ -512,18 +745,20 @@ public:
       custom::list<int>::Node* pDes2 = new custom::list<int>::Node(int(99));
       pDes1->pNext = pDes2;
       pDes2->pPrev = pDes1;
-      lDes.pHead = pDes1;
-      lDes.pTail = pDes2;
+      pDes1->pPrev = &lDes.sentinel;
+      pDes2->pNext = &lDes.sentinel;
+      lDes.sentinel.pNext = pDes1;
+      lDes.sentinel.pPrev = pDes2;
       lDes.numElements = 2;
       // exercise
       lDes = lSrc;
       // verify
-      assertUnit(lSrc.pHead != lDes.pHead);
-      if (lSrc.pHead && lDes.pHead)
+      assertUnit(lSrc.sentinel.pNext != lDes.sentinel.pNext);
+      if (lSrc.sentinel.pNext != &lSrc.sentinel && lDes.sentinel.pNext != &lDes.sentinel)
       {
-         assertUnit(lSrc.pHead->pNext != lDes.pHead->pNext);
-         if (lSrc.pHead->pNext && lDes.pHead->pNext)
-            assertUnit(lSrc.pHead->pNext->pNext != lDes.pHead->pNext->pNext);
+         assertUnit(lSrc.sentinel.pNext->pNext != lDes.sentinel.pNext->pNext);
+         if (lSrc.sentinel.pNext->pNext != &lSrc.sentinel && lDes.sentinel.pNext->pNext != &lDes.sentinel)
+            assertUnit(lSrc.sentinel.pNext->pNext->pNext != lDes.sentinel.pNext->pNext->pNext);
       }
       // lSrc   pHead             pTail
       //       +----+   +----+   +----+
@@ -564,17 +799,19 @@ public:
       lDes4->pPrev = lDes3;
       lDes3->pPrev = lDes2;
       lDes2->pPrev = lDes1;
-      lDes.pHead = lDes1;
-      lDes.pTail = lDes4;
+      lDes1->pPrev = &lDes.sentinel;
+      lDes4->pNext = &lDes.sentinel;
+      lDes.sentinel.pNext = lDes1;
+      lDes.sentinel.pPrev = lDes4;
       lDes.numElements = 4;
       // exercise
       lDes = lSrc;
       // verify
-      if (lSrc.pHead && lDes.pHead)
+      if (lSrc.sentinel.pNext != &lSrc.sentinel && lDes.sentinel.pNext != &lDes.sentinel)
       {
-         assertUnit(lSrc.pHead->pNext != lDes.pHead->pNext);
-         if (lSrc.pHead->pNext && lDes.pHead->pNext)
-            assertUnit(lSrc.pHead->pNext->pNext != lDes.pHead->pNext->pNext);
+         assertUnit(lSrc.sentinel.pNext->pNext != lDes.sentinel.pNext->pNext);
+         if (lSrc.sentinel.pNext->pNext != &lSrc.sentinel && lDes.sentinel.pNext->pNext != &lDes.sentinel)
+            assertUnit(lSrc.sentinel.pNext->pNext->pNext != lDes.sentinel.pNext->pNext->pNext);
       }
       // lSrc   pHead             pTail
       //       +----+   +----+   +----+
@@ -615,9 +852,9 @@ public:
       //       +----+   +----+   +----+
       custom::list<int> l;
       setupStandardFixture(l);
-      l.pHead->data = 99;
-      l.pHead->pNext->data = 99;
-      l.pHead->pNext->pNext->data = 99;
+      l.sentinel.pNext->node()->data = 99;
+      l.sentinel.pNext->pNext->node()->data = 99;
+      l.sentinel.pNext->pNext->pNext->node()->data = 99;
       std::initializer_list<int> il{ int(11),int(26),int(31) };
       // exercise
       l = il;   // l = {int(11), int(26), int(31) }
@@ -639,7 +876,9 @@ public:
       //       | 99 |
       //       +----+
       custom::list<int> l;
-      l.pHead = l.pTail = new custom::list<int>::Node(int(99));
+      custom::list<int>::Node* p = new custom::list<int>::Node(int(99));
+      p->pNext = p->pPrev = &l.sentinel;
+      l.sentinel.pNext = l.sentinel.pPrev = p;
       l.numElements = 1;
       std::initializer_list<int> il{ int(11),int(26),int(31) };
       // exercise
@@ -672,8 +911,10 @@ public:
       p4->pPrev = p3;
       p3->pPrev = p2;
       p2->pPrev = p1;
-      l.pHead = p1;
-      l.pTail = p4;
+      p1->pPrev = &l.sentinel;
+      p4->pNext = &l.sentinel;
+      l.sentinel.pNext = p1;
+      l.sentinel.pPrev = p4;
       l.numElements = 4;
       std::initializer_list<int> il{ int(11),int(26),int(31) };
       // exercise
@@ -733,15 +974,15 @@ public:
       //       +----+
       //       | 99 |
       //       +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       { 
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext == nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
       }
       // teardown
       assertUnit(s == int(99));
@@ -765,21 +1006,21 @@ public:
       //       +----+   +----+   +----+   +----+
       //       | 11 | - | 26 | - | 31 | - | 99 |
       //       +----+   +----+   +----+   +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
       assertUnit(l.numElements == 4);
-      if (l.pTail)
+      if (l.sentinel.pPrev != &l.sentinel)
       {
-         assertUnit(l.pTail->data == int(99));
-         assertUnit(l.pTail->pNext == nullptr);
-         assertUnit(l.pTail->pPrev != nullptr);
-         if (l.pTail->pPrev)
+         assertUnit(l.sentinel.pPrev->node()->data == int(99));
+         assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pPrev->pPrev != &l.sentinel);
+         if (l.sentinel.pPrev->pPrev != &l.sentinel)
          {
-            assertUnit(l.pTail->pPrev->pNext == l.pTail);
-            l.pTail = l.pTail->pPrev;
-            delete l.pTail->pNext;
+            assertUnit(l.sentinel.pPrev->pPrev->pNext == l.sentinel.pPrev);
+            l.sentinel.pPrev = l.sentinel.pPrev->pPrev;
+            delete l.sentinel.pPrev->pNext;
             l.numElements--;
-            l.pTail->pNext = nullptr;
+            l.sentinel.pPrev->pNext = &l.sentinel;
          }
       }
       assertUnit(s == int(99));
@@ -799,15 +1040,15 @@ public:
       //       +----+
       //       | 99 |
       //       +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext == nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
       }
       assertUnit(s == 99);
       // teardown
@@ -831,21 +1072,21 @@ public:
       //       +----+   +----+   +----+   +----+
       //       | 11 | - | 26 | - | 31 | - | 99 |
       //       +----+   +----+   +----+   +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
       assertUnit(l.numElements == 4);
-      if (l.pTail)
+      if (l.sentinel.pPrev != &l.sentinel)
       {
-         assertUnit(l.pTail->data == int(99));
-         assertUnit(l.pTail->pNext == nullptr);
-         assertUnit(l.pTail->pPrev != nullptr);
-         if (l.pTail->pPrev)
+         assertUnit(l.sentinel.pPrev->node()->data == int(99));
+         assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pPrev->pPrev != &l.sentinel);
+         if (l.sentinel.pPrev->pPrev != &l.sentinel)
          {
-            assertUnit(l.pTail->pPrev->pNext == l.pTail);
-            l.pTail = l.pTail->pPrev;
-            delete l.pTail->pNext;
+            assertUnit(l.sentinel.pPrev->pPrev->pNext == l.sentinel.pPrev);
+            l.sentinel.pPrev = l.sentinel.pPrev->pPrev;
+            delete l.sentinel.pPrev->pNext;
             l.numElements--;
-            l.pTail->pNext = nullptr;
+            l.sentinel.pPrev->pNext = &l.sentinel;
          }
       }
       assertUnit(s == 99);
@@ -869,15 +1110,15 @@ public:
       //       +----+
       //       | 99 |
       //       +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pTail)
+      if (l.sentinel.pPrev != &l.sentinel)
       {
-         assertUnit(l.pTail->data == int(99));
-         assertUnit(l.pTail->pNext == nullptr);
-         assertUnit(l.pTail->pPrev == nullptr);
+         assertUnit(l.sentinel.pPrev->node()->data == int(99));
+         assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pPrev->pPrev == &l.sentinel);
       }
       assertUnit(s == int(99));
       // teardown
@@ -901,21 +1142,21 @@ public:
       //       +----+   +----+   +----+   +----+
       //       | 99 | - | 11 | - | 26 | - | 31 |
       //       +----+   +----+   +----+   +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
       assertUnit(l.numElements == 4);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            l.pHead = l.pHead->pNext;
-            delete l.pHead->pPrev;
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            l.sentinel.pNext = l.sentinel.pNext->pNext;
+            delete l.sentinel.pNext->pPrev;
             l.numElements--;
-            l.pHead->pPrev = nullptr;
+            l.sentinel.pNext->pPrev = &l.sentinel;
          }
       }
       assertUnit(s == int(99));
@@ -935,15 +1176,15 @@ public:
       //       +----+
       //       | 99 |
       //       +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pTail)
+      if (l.sentinel.pPrev != &l.sentinel)
       {
-         assertUnit(l.pTail->data == int(99));
-         assertUnit(l.pTail->pNext == nullptr);
-         assertUnit(l.pTail->pPrev == nullptr);
+         assertUnit(l.sentinel.pPrev->node()->data == int(99));
+         assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pPrev->pPrev == &l.sentinel);
       }
       assertUnit(s == 99);
       // teardown
@@ -967,21 +1208,21 @@ public:
       //       +----+   +----+   +----+   +----+
       //       | 99 | - | 11 | - | 26 | - | 31 |
       //       +----+   +----+   +----+   +----+
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
       assertUnit(l.numElements == 4);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            l.pHead = l.pHead->pNext;
-            delete l.pHead->pPrev;
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            l.sentinel.pNext = l.sentinel.pNext->pNext;
+            delete l.sentinel.pNext->pPrev;
             l.numElements--;
-            l.pHead->pPrev = nullptr;
+            l.sentinel.pNext->pPrev = &l.sentinel;
          }
       }
       
@@ -1015,9 +1256,10 @@ public:
       custom::list<int> l;
       setupStandardFixture(l);
       custom::list<int>::Node* p = new custom::list<int>::Node(int(99));
-      l.pTail->pNext = p;
-      p->pPrev = l.pTail;
-      l.pTail = p;
+      l.sentinel.pPrev->pNext = p;
+      p->pPrev = l.sentinel.pPrev;
+      p->pNext = &l.sentinel;
+      l.sentinel.pPrev = p;
       l.numElements++;
       // exercise
       l.pop_back();
@@ -1042,8 +1284,8 @@ public:
       // exercise
       l.pop_front();
       // verify
-      assertUnit(l.pHead == NULL);
-      assertUnit(l.pTail == NULL);
+      assertUnit(l.sentinel.pNext == &l.sentinel);
+      assertUnit(l.sentinel.pPrev == &l.sentinel);
       assertUnit(l.numElements == 0);
       assertUnit(l.size() == 0);
       assertUnit(l.empty() == true);
@@ -1059,9 +1301,10 @@ public:
       custom::list<int> l;
       setupStandardFixture(l);
       custom::list<int>::Node* p = new custom::list<int>::Node(int(99));
-      l.pHead->pPrev = p;
-      p->pNext = l.pHead;
-      l.pHead = p;
+      l.sentinel.pNext->pPrev = p;
+      p->pNext = l.sentinel.pNext;
+      p->pPrev = &l.sentinel;
+      l.sentinel.pNext = p;
       l.numElements++;
       // exercise
       l.pop_front();
@@ -1075,6 +1318,52 @@ public:
       teardownStandardFixture(l);
    }
 
+   // pop the back of a list with one element
+   void test_popback_single()
+   {  // setup
+      custom::list<int> l;
+      l.push_back(int(99));
+      // exercise
+      l.pop_back();
+      // verify
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // pop the front of a list with one element
+   void test_popfront_single()
+   {  // setup
+      custom::list<int> l;
+      l.push_back(int(99));
+      // exercise
+      l.pop_front();
+      // verify
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // a queue that keeps going never holds more nodes than elements
+   void test_pop_queueReclaims()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+      l.push_back(int(11));
+      l.push_back(int(26));
+      // exercise
+      for (int i = 0; i < 1000; i++)
+      {
+         l.push_back(i);
+         l.pop_front();
+         l.push_front(i);
+         l.pop_back();
+      }
+      // verify
+      assertUnit(live == 2);
+      assertUnit(l.size() == 2);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+      assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+      assertUnit(l.sentinel.pPrev->pPrev == l.sentinel.pNext);
+   }  // teardown
+
    /***************************************
     * FRONT and BACK
     ***************************************/
@@ -1138,8 +1427,8 @@ public:
       //       +----+   +----+   +----+
       //       | 99 | - | 26 | - | 31 |
       //       +----+   +----+   +----+
-      assertUnit(l.pHead->data == int(99));
-      l.pHead->data = int(11);
+      assertUnit(l.sentinel.pNext->node()->data == int(99));
+      l.sentinel.pNext->node()->data = int(11);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1204,8 +1493,8 @@ public:
       //       +----+   +----+   +----+
       //       | 11 | - | 26 | - | 99 |
       //       +----+   +----+   +----+
-      assertUnit(l.pTail->data == int(99));
-      l.pTail->data = int(31);
+      assertUnit(l.sentinel.pPrev->node()->data == int(99));
+      l.sentinel.pPrev->node()->data = int(31);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1222,7 +1511,7 @@ public:
       custom::list<int> l;
       custom::list<int>::iterator it;
       custom::list<int>::iterator itReturn;
-      it.p = nullptr;
+      it.p = &l.sentinel;
       int s(99);
       // exercise
       itReturn = l.insert(it, s);
@@ -1231,20 +1520,20 @@ public:
       //       | 99 |
       //       +----+
       //      itReturn
-      assertUnit(it.p == nullptr);
-      assertUnit(itReturn.p == l.pHead);
+      assertUnit(it.p == &l.sentinel);
+      assertUnit(itReturn.p == l.sentinel.pNext);
       assertUnit(itReturn == l.begin());
       if (itReturn.p != nullptr)
          assertUnit(*itReturn == int(99));
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext == nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
       }
       // teardown
       teardownStandardFixture(l);
@@ -1261,7 +1550,7 @@ public:
       //         it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead;
+      it.p = l.sentinel.pNext;
       int s(99);
       // exercise
       itReturn = l.insert(it, s);
@@ -1272,34 +1561,34 @@ public:
       //      itReturn    it
       assertUnit(it.p != nullptr);
       if (it.p)
-         assertUnit(it.p->data == int(11));
+         assertUnit(it.p->node()->data == int(11));
       assertUnit(itReturn.p != nullptr);
       if (itReturn.p)
-         assertUnit(itReturn.p->data == int(99));
+         assertUnit(itReturn.p->node()->data == int(99));
       assertUnit(l.numElements == 4);
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(11));
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(11));
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(26));
-               assertUnit(l.pHead->pNext->pNext->pNext != nullptr);
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == l.pTail);
-               if (l.pHead->pNext->pNext->pNext)
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(26));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == l.sentinel.pPrev);
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel)
                {
-                  assertUnit(l.pHead->pNext->pNext->pNext->data == int(31));
-                  assertUnit(l.pHead->pNext->pNext->pNext->pNext == nullptr);
-                  assertUnit(l.pHead->pNext->pNext->pNext->pPrev == l.pHead->pNext->pNext);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->node()->data == int(31));
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pNext == &l.sentinel);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext->pNext);
                }
             }
          }
@@ -1319,7 +1608,7 @@ public:
       //                  it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead->pNext;
+      it.p = l.sentinel.pNext->pNext;
       int s(99);
       // exercise
       itReturn = l.insert(it, s);
@@ -1330,34 +1619,34 @@ public:
       //               itReturn    it
       assertUnit(it.p != nullptr);
       if (it.p)
-         assertUnit(it.p->data == int(26));
+         assertUnit(it.p->node()->data == int(26));
       assertUnit(itReturn.p != nullptr);
       if (itReturn.p)
-         assertUnit(itReturn.p->data == int(99));
+         assertUnit(itReturn.p->node()->data == int(99));
       assertUnit(l.numElements == 4);
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(11));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(11));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(99));
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(99));
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(26));
-               assertUnit(l.pHead->pNext->pNext->pNext != nullptr);
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == l.pTail);
-               if (l.pHead->pNext->pNext->pNext)
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(26));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == l.sentinel.pPrev);
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel)
                {
-                  assertUnit(l.pHead->pNext->pNext->pNext->data == int(31));
-                  assertUnit(l.pHead->pNext->pNext->pNext->pNext == nullptr);
-                  assertUnit(l.pHead->pNext->pNext->pNext->pPrev == l.pHead->pNext->pNext);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->node()->data == int(31));
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pNext == &l.sentinel);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext->pNext);
                }
             }
          }
@@ -1377,6 +1666,7 @@ public:
       //                                  it
       custom::list<int> l;
       setupStandardFixture(l);
+      it = l.end();
       int s(99);
       // exercise
       itReturn = l.insert(it, s);
@@ -1385,34 +1675,34 @@ public:
       //       | 11 | - | 26 | - | 31 | - | 99 |
       //       +----+   +----+   +----+   +----+
       //                                  itReturn    it
-      assertUnit(it.p == nullptr);
+      assertUnit(it.p == &l.sentinel);
       assertUnit(itReturn.p != nullptr);
       if (itReturn.p)
-         assertUnit(itReturn.p->data == int(99));
+         assertUnit(itReturn.p->node()->data == int(99));
       assertUnit(l.numElements == 4);
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(11));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(11));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(26));
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(26));
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(31));
-               assertUnit(l.pHead->pNext->pNext->pNext != nullptr);
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == l.pTail);
-               if (l.pHead->pNext->pNext->pNext)
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(31));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == l.sentinel.pPrev);
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel)
                {
-                  assertUnit(l.pHead->pNext->pNext->pNext->data == int(99));
-                  assertUnit(l.pHead->pNext->pNext->pNext->pNext == nullptr);
-                  assertUnit(l.pHead->pNext->pNext->pNext->pPrev == l.pHead->pNext->pNext);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->node()->data == int(99));
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pNext == &l.sentinel);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext->pNext);
                }
             }
          }
@@ -1431,7 +1721,7 @@ public:
       custom::list<int> l;
       custom::list<int>::iterator it;
       custom::list<int>::iterator itReturn;
-      it.p = nullptr;
+      it.p = &l.sentinel;
       int s(99);
       // exercise
       itReturn = l.insert(it, std::move(s));
@@ -1444,16 +1734,16 @@ public:
       assertUnit(itReturn.p != nullptr);
       assertUnit(itReturn == l.begin());
       if (itReturn.p != nullptr)
-         assertUnit(itReturn.p->data == int(99));
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      assertUnit(l.pTail == l.pHead);
+         assertUnit(itReturn.p->node()->data == int(99));
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      assertUnit(l.sentinel.pPrev == l.sentinel.pNext);
       assertUnit(l.numElements == 1);
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext == nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext == &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
       }
       // teardown
       teardownStandardFixture(l);
@@ -1470,7 +1760,7 @@ public:
       //         it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead;
+      it.p = l.sentinel.pNext;
       int s(99);
       // exercise
       itReturn = l.insert(it, std::move(s));
@@ -1482,34 +1772,34 @@ public:
       assertUnit(s == 99);
       assertUnit(it.p != nullptr);
       if (it.p)
-         assertUnit(it.p->data == int(11));
+         assertUnit(it.p->node()->data == int(11));
       assertUnit(itReturn.p != nullptr);
       if (itReturn.p)
-         assertUnit(itReturn.p->data == int(99));
+         assertUnit(itReturn.p->node()->data == int(99));
       assertUnit(l.numElements == 4);
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(99));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(99));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(11));
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(11));
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(26));
-               assertUnit(l.pHead->pNext->pNext->pNext != nullptr);
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == l.pTail);
-               if (l.pHead->pNext->pNext->pNext)
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(26));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == l.sentinel.pPrev);
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel)
                {
-                  assertUnit(l.pHead->pNext->pNext->pNext->data == int(31));
-                  assertUnit(l.pHead->pNext->pNext->pNext->pNext == nullptr);
-                  assertUnit(l.pHead->pNext->pNext->pNext->pPrev == l.pHead->pNext->pNext);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->node()->data == int(31));
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pNext == &l.sentinel);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext->pNext);
                }
             }
          }
@@ -1529,7 +1819,7 @@ public:
       //                  it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead->pNext;
+      it.p = l.sentinel.pNext->pNext;
       int s(99);
       // exercise
       itReturn = l.insert(it, std::move(s));
@@ -1541,34 +1831,34 @@ public:
       assertUnit(s == 99);
       assertUnit(it.p != nullptr);
       if (it.p)
-         assertUnit(it.p->data == int(26));
+         assertUnit(it.p->node()->data == int(26));
       assertUnit(itReturn.p != nullptr);
       if (itReturn.p)
-         assertUnit(itReturn.p->data == int(99));
+         assertUnit(itReturn.p->node()->data == int(99));
       assertUnit(l.numElements == 4);
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pTail != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(11));
-         assertUnit(l.pHead->pNext != nullptr);
-         assertUnit(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pPrev != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(11));
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(99));
-            assertUnit(l.pHead->pNext->pNext != nullptr);
-            assertUnit(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(99));
+            assertUnit(l.sentinel.pNext->pNext->pNext != &l.sentinel);
+            assertUnit(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertUnit(l.pHead->pNext->pNext->data == int(26));
-               assertUnit(l.pHead->pNext->pNext->pNext != nullptr);
-               assertUnit(l.pHead->pNext->pNext->pPrev == l.pHead->pNext);
-               assertUnit(l.pHead->pNext->pNext->pNext == l.pTail);
-               if (l.pHead->pNext->pNext->pNext)
+               assertUnit(l.sentinel.pNext->pNext->pNext->node()->data == int(26));
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext);
+               assertUnit(l.sentinel.pNext->pNext->pNext->pNext == l.sentinel.pPrev);
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel)
                {
-                  assertUnit(l.pHead->pNext->pNext->pNext->data == int(31));
-                  assertUnit(l.pHead->pNext->pNext->pNext->pNext == nullptr);
-                  assertUnit(l.pHead->pNext->pNext->pNext->pPrev == l.pHead->pNext->pNext);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->node()->data == int(31));
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pNext == &l.sentinel);
+                  assertUnit(l.sentinel.pNext->pNext->pNext->pNext->pPrev == l.sentinel.pNext->pNext->pNext);
                }
             }
          }
@@ -1588,7 +1878,7 @@ public:
       custom::list<int> l;
       custom::list<int>::iterator itErase;
       custom::list<int>::iterator itReturn;
-      itErase.p = nullptr;
+      itErase.p = &l.sentinel;
       // exercise
       itReturn = l.erase(itErase);
       // verify
@@ -1609,10 +1899,10 @@ public:
       //         itErase
       custom::list<int> l;
       setupStandardFixture(l);
-      custom::list<int>::Node* p1 = l.pHead;
-      custom::list<int>::Node* p2 = p1->pNext;
-      custom::list<int>::Node* p3 = p2->pNext;
-      itErase.p = l.pHead;
+      custom::list<int>::Link* p1 = l.sentinel.pNext;
+      custom::list<int>::Link* p2 = p1->pNext;
+      custom::list<int>::Link* p3 = p2->pNext;
+      itErase.p = l.sentinel.pNext;
       // exercise
       itReturn = l.erase(itErase);
       // verify
@@ -1622,20 +1912,20 @@ public:
       //       | 26 | - | 31 |
       //       +----+   +----+
       //        itReturn
-      assertUnit(l.pHead == p2);
-      assertUnit(l.pTail == p3);
+      assertUnit(l.sentinel.pNext == p2);
+      assertUnit(l.sentinel.pPrev == p3);
       assertUnit(l.numElements == 2);
-      assertUnit(l.pHead != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(26));
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext != nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(26));
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(31));
-            assertUnit(l.pHead->pNext->pNext == nullptr);
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(31));
+            assertUnit(l.sentinel.pNext->pNext->pNext == &l.sentinel);
          }
       }
       // teardown
@@ -1654,9 +1944,9 @@ public:
       //                  itErase
       custom::list<int> l;
       setupStandardFixture(l);
-      custom::list<int>::Node* p1 = l.pHead;
-      custom::list<int>::Node* p2 = p1->pNext;
-      custom::list<int>::Node* p3 = p2->pNext;
+      custom::list<int>::Link* p1 = l.sentinel.pNext;
+      custom::list<int>::Link* p2 = p1->pNext;
+      custom::list<int>::Link* p3 = p2->pNext;
       itErase.p = p2;
       // exercise
       itReturn = l.erase(itErase);
@@ -1667,20 +1957,20 @@ public:
       //       | 11 | - | 31 |
       //       +----+   +----+
       //                  itReturn
-      assertUnit(l.pHead == p1);
-      assertUnit(l.pTail == p3);
+      assertUnit(l.sentinel.pNext == p1);
+      assertUnit(l.sentinel.pPrev == p3);
       assertUnit(l.numElements == 2);
-      assertUnit(l.pHead != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(11));
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext != nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(11));
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(31));
-            assertUnit(l.pHead->pNext->pNext == nullptr);
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(31));
+            assertUnit(l.sentinel.pNext->pNext->pNext == &l.sentinel);
          }
       }
       // teardown
@@ -1699,34 +1989,34 @@ public:
       //                           itErase
       custom::list<int> l;
       setupStandardFixture(l);
-      custom::list<int>::Node* p1 = l.pHead;
-      custom::list<int>::Node* p2 = p1->pNext;
-      custom::list<int>::Node* p3 = p2->pNext;
+      custom::list<int>::Link* p1 = l.sentinel.pNext;
+      custom::list<int>::Link* p2 = p1->pNext;
+      custom::list<int>::Link* p3 = p2->pNext;
       itErase.p = p3;
       // exercise
       itReturn = l.erase(itErase);
       // verify
-      assertUnit(itReturn.p == NULL);
+      assertUnit(itReturn.p == &l.sentinel);
       assertUnit(itReturn == l.end());
       //        pHead    pTail
       //       +----+   +----+
       //       | 11 | - | 26 |
       //       +----+   +----+
       //                         itErase = NULL
-      assertUnit(l.pHead == p1);
-      assertUnit(l.pTail == p2);
+      assertUnit(l.sentinel.pNext == p1);
+      assertUnit(l.sentinel.pPrev == p2);
       assertUnit(l.numElements == 2);
-      assertUnit(l.pHead != nullptr);
-      if (l.pHead)
-      {
-         assertUnit(l.pHead->data == int(11));
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext == l.pTail);
-         assertUnit(l.pHead->pNext != nullptr);
-         if (l.pHead->pNext)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel)
+      {
+         assertUnit(l.sentinel.pNext->node()->data == int(11));
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertUnit(l.pHead->pNext->data == int(26));
-            assertUnit(l.pHead->pNext->pNext == nullptr);
+            assertUnit(l.sentinel.pNext->pNext->node()->data == int(26));
+            assertUnit(l.sentinel.pNext->pNext->pNext == &l.sentinel);
          }
       }
       // teardown
@@ -1746,7 +2036,7 @@ public:
       // exercise
       it = l.begin();
       // verify
-      assertUnit(it.p == nullptr);
+      assertUnit(it.p == &l.sentinel);
       assertUnit(it == l.end());
       assertEmptyFixture(l);
    }  // teardown
@@ -1769,7 +2059,7 @@ public:
       //       | 11 | - | 26 | - | 31 |
       //       +----+   +----+   +----+
       //         it
-      assertUnit(it.p == l.pHead);
+      assertUnit(it.p == l.sentinel.pNext);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1793,7 +2083,7 @@ public:
       //       | 11 | - | 26 | - | 31 |
       //       +----+   +----+   +----+
       //                                    it = NULL
-      assertUnit(it.p == nullptr);
+      assertUnit(it.p == &l.sentinel);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1810,7 +2100,7 @@ public:
       //                  it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead->pNext;
+      it.p = l.sentinel.pNext->pNext;
       // exercise
       ++it;
       // verify
@@ -1819,7 +2109,7 @@ public:
       //       | 11 | - | 26 | - | 31 |
       //       +----+   +----+   +----+
       //                           it
-      assertUnit(it.p == l.pTail);
+      assertUnit(it.p == l.sentinel.pPrev);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1836,7 +2126,7 @@ public:
       //                  it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead->pNext;
+      it.p = l.sentinel.pNext->pNext;
       int s(99);
       // exercise
       s = *it;
@@ -1847,7 +2137,7 @@ public:
       //       +----+   +----+   +----+
       //                  it
       assertUnit(s == int(26));
-      assertUnit(it.p == l.pHead->pNext);
+      assertUnit(it.p == l.sentinel.pNext->pNext);
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
@@ -1864,7 +2154,7 @@ public:
       //                  it
       custom::list<int> l;
       setupStandardFixture(l);
-      it.p = l.pHead->pNext;
+      it.p = l.sentinel.pNext->pNext;
       int s(99);
       // exercise
       *it = s;
@@ -1874,19 +2164,1996 @@ public:
       //       | 11 | - | 99 | - | 31 |
       //       +----+   +----+   +----+
       //                  it
-      assertUnit(l.pHead != nullptr);
-      assertUnit(l.pHead->pNext != nullptr);
-      if (l.pHead != nullptr && l.pHead->pNext != nullptr)
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pNext->pNext != &l.sentinel);
+      if (l.sentinel.pNext != &l.sentinel && l.sentinel.pNext->pNext != &l.sentinel)
       {
-         assertUnit(it.p == l.pHead->pNext);
-         assertUnit(l.pHead->pNext->data == int(99));
-         l.pHead->pNext->data = int(26);
+         assertUnit(it.p == l.sentinel.pNext->pNext);
+         assertUnit(l.sentinel.pNext->pNext->node()->data == int(99));
+         l.sentinel.pNext->pNext->node()->data = int(26);
       }
       assertStandardFixture(l);
       // teardown
       teardownStandardFixture(l);
    }
 
+   // increment past the tail lands on the sentinel, which is end()
+   void test_iterator_increment_tailToEnd()
+   {  // setup
+      //        pHead             pTail
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      //                           it
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator it(l.sentinel.pPrev);
+      // exercise
+      ++it;
+      // verify
+      assertUnit(it == l.end());
+      assertUnit(it.p == &l.sentinel);
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // decrement end() to reach the tail
+   void test_iterator_decrement_end()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator it = l.end();
+      // exercise
+      --it;
+      // verify
+      //        pHead             pTail
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      //                           it
+      assertUnit(it.p == l.sentinel.pPrev);
+      assertUnit(*it == int(31));
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // postfix increment hands back where it was
+   void test_iterator_postfix_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator it = l.begin();
+      // exercise
+      custom::list<int>::iterator itOld = it++;
+      // verify
+      assertUnit(itOld.p == l.sentinel.pNext);
+      assertUnit(it.p == l.sentinel.pNext->pNext);
+      itOld = it--;
+      assertUnit(itOld.p == l.sentinel.pNext->pNext);
+      assertUnit(it.p == l.sentinel.pNext);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // walk the standard fixture backwards
+   void test_iterator_reverse_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      int expected[] = { 31, 26, 11 };
+      int i = 0;
+      // exercise
+      for (custom::list<int>::reverse_iterator it = l.rbegin(); it != l.rend(); ++it)
+      {
+         // verify
+         assertUnit(i < 3 && *it == expected[i]);
+         i++;
+      }
+      assertUnit(i == 3);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // an empty list has nothing to walk backwards
+   void test_iterator_reverse_empty()
+   {  // setup
+      custom::list<int> l;
+      // exercise
+      custom::list<int>::reverse_iterator it = l.rbegin();
+      // verify
+      assertUnit(it == l.rend());
+      assertUnit(it.base() == l.end());
+   }  // teardown
+
+   /***************************************
+    * ALLOCATOR
+    ***************************************/
+
+   // every push and erase goes through the allocator
+   void test_allocator_pushErase()
+   {  // setup
+      int live = 0;
+      CountingAllocator<int> a(&live);
+      {
+         custom::list<int, CountingAllocator<int>> l(a);
+         // exercise
+         l.push_back(int(11));
+         l.push_front(int(26));
+         l.insert(l.begin(), int(31));
+         // verify
+         assertUnit(live == 3);
+         l.erase(l.begin());
+         assertUnit(live == 2);
+         assertUnit(l.size() == 2);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // the fill constructor uses the allocator it was given
+   void test_allocator_fill()
+   {  // setup
+      int live = 0;
+      CountingAllocator<int> a(&live);
+      {
+         // exercise
+         custom::list<int, CountingAllocator<int>> l(size_t(3), int(99), a);
+         // verify
+         assertUnit(l.size() == 3);
+         assertUnit(live > 0);
+         assertUnit(l.get_allocator() == a);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // the copy shares the source's allocator
+   void test_allocator_copy()
+   {  // setup
+      int live = 0;
+      CountingAllocator<int> a(&live);
+      {
+         custom::list<int, CountingAllocator<int>> lSrc({ 11, 26, 31 }, a);
+         int liveSrc = live;
+         // exercise
+         custom::list<int, CountingAllocator<int>> lDest(lSrc);
+         // verify
+         assertUnit(live == liveSrc + 3);
+         assertUnit(lDest.get_allocator() == a);
+         assertUnit(lDest.size() == 3);
+         assertUnit(lDest.front() == 11);
+         assertUnit(lDest.back() == 31);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // moving between unequal allocators moves element by element
+   void test_allocator_moveUnequal()
+   {  // setup
+      int liveSrc = 0;
+      int liveDest = 0;
+      {
+         custom::list<int, CountingAllocator<int>> lSrc({ 11, 26, 31 }, CountingAllocator<int>(&liveSrc));
+         custom::list<int, CountingAllocator<int>> lDest{ CountingAllocator<int>(&liveDest) };
+         // exercise
+         lDest = std::move(lSrc);
+         // verify
+         assertUnit(lSrc.empty());
+         assertUnit(liveSrc == 0);
+         assertUnit(liveDest == 3);
+         assertUnit(lDest.size() == 3);
+         assertUnit(lDest.front() == 11);
+         assertUnit(lDest.back() == 31);
+      }
+      assertUnit(liveDest == 0);
+   }  // teardown
+
+   /***************************************
+    * NODE RECYCLING
+    ***************************************/
+
+   // without a high-water mark nothing is kept around
+   void test_recycle_offByDefault()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.cached_nodes() == 0);
+      assertUnit(l.pFree == nullptr);
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // an erased node is handed back out by the next push
+   void test_recycle_reuse()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+      l.set_node_recycling(10);
+      l.push_back(int(11));
+      l.push_back(int(26));
+      custom::list<int, CountingAllocator<int>>::Link* p = l.sentinel.pPrev;
+      // exercise
+      l.pop_back();
+      assertUnit(l.cached_nodes() == 1);
+      l.push_front(int(31));
+      // verify
+      assertUnit(l.cached_nodes() == 0);
+      assertUnit(live == 2);
+      assertUnit(l.sentinel.pNext == p);
+      assertUnit(l.front() == 31);
+      assertUnit(l.back() == 11);
+   }  // teardown
+
+   // the cache never grows past the high-water mark
+   void test_recycle_highWater()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> l({ 11, 26, 31, 42, 57 },
+                                                     CountingAllocator<int>(&live));
+         l.set_node_recycling(3);
+         // exercise
+         l.clear();
+         // verify
+         assertUnit(l.cached_nodes() == 3);
+         assertUnit(live == 3);
+         l.set_node_recycling(1);
+         assertUnit(l.cached_nodes() == 1);
+         assertUnit(live == 1);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // release gives every cached node back to the allocator
+   void test_recycle_release()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l({ 11, 26, 31 },
+                                                  CountingAllocator<int>(&live));
+      l.set_node_recycling(10);
+      l.erase(l.begin());
+      l.pop_front();
+      assertUnit(l.cached_nodes() == 2);
+      // exercise
+      l.release_cached_nodes();
+      // verify
+      assertUnit(l.cached_nodes() == 0);
+      assertUnit(live == 1);
+      assertUnit(l.size() == 1);
+      assertUnit(l.front() == 31);
+   }  // teardown
+
+   /***************************************
+    * BULK CONSTRUCTION
+    ***************************************/
+
+   // the fill constructor lays its nodes out back to back
+   void test_block_fillContiguous()
+   {  // exercise
+      custom::list<int> l(size_t(4), int(99));
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(l.blocks.size() == 1);
+      custom::list<int>::Link* p = l.sentinel.pNext;
+      for (size_t i = 0; p != &l.sentinel; i++, p = p->pNext)
+      {
+         assertUnit(p->node() == l.sentinel.pNext->node() + i);
+         assertUnit(p->node()->data == int(99));
+      }
+      assertUnit(l.sentinel.pPrev->node() == l.sentinel.pNext->node() + 3);
+   }  // teardown
+
+   // a counted range is built in one block, in order
+   void test_block_rangeContiguous()
+   {  // setup
+      std::vector<int> v{ 11, 26, 31, 42 };
+      // exercise
+      custom::list<int> l(v.begin(), v.end());
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(l.blocks.size() == 1);
+      assertUnit(l.sentinel.pNext->pNext->node() == l.sentinel.pNext->node() + 1);
+      assertUnit(l.sentinel.pPrev->node() == l.sentinel.pNext->node() + 3);
+      assertUnit(l.sentinel.pPrev->pPrev->node() == l.sentinel.pNext->node() + 2);
+      assertUnit(l.front() == 11);
+      assertUnit(l.back() == 42);
+   }  // teardown
+
+   // the block is only freed once its last node is erased
+   void test_block_eraseHoles()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> l(size_t(4), int(99),
+                                                     CountingAllocator<int>(&live));
+         int liveBuilt = live;
+         auto it = l.begin();
+         ++it;
+         // exercise
+         l.erase(it);
+         l.push_back(int(11));
+         l.pop_front();
+         l.pop_front();
+         // verify
+         assertUnit(live == liveBuilt + 1);
+         assertUnit(l.size() == 2);
+         l.pop_front();
+         assertUnit(live == liveBuilt - 1);   // block and its header are gone
+         assertUnit(l.size() == 1);
+         assertUnit(l.front() == 11);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   /***************************************
+    * THREAD NODE CACHE
+    ***************************************/
+
+   // a node given up by one list is picked up by the next
+   void test_threadCache_shared()
+   {  // setup
+      custom::list<int> l1;
+      custom::list<int> l2;
+      l1.push_back(int(11));
+      custom::list<int>::Link* p = l1.sentinel.pNext;
+      // exercise
+      l1.clear();
+      l2.push_back(int(26));
+      // verify
+      assertUnit(l2.sentinel.pNext == p);
+      assertUnit(l2.front() == 26);
+      assertEmptyFixture(l1);
+   }  // teardown
+
+   // a thread never holds more than its limit
+   void test_threadCache_bounded()
+   {  // setup
+      using cache = custom::node_cache<std::allocator<custom::list<int>::Node>>;
+      {
+         custom::list<int> l;
+         for (int i = 0; i < 1000; i++)
+            l.push_back(i);
+      } // exercise
+      // verify
+      assertUnit(cache::size() <= cache::threadLimit);
+      assertUnit(cache::size() > 0);
+   }  // teardown
+
+   // a thread that exits leaves its spare nodes in the depot
+   void test_threadCache_depot()
+   {  // setup
+      using cache = custom::node_cache<std::allocator<custom::list<int>::Node>>;
+      size_t spare = 0;
+      size_t depot = 0;
+      // exercise
+      std::thread t([&]()
+         {
+            custom::list<int> l;
+            for (int i = 0; i < 100; i++)
+               l.push_back(i);
+            l.clear();
+            spare = cache::size();
+            std::lock_guard<std::mutex> lock(cache::Depot::instance().mutex);
+            depot = cache::Depot::instance().count;
+         });
+      t.join();
+      // verify
+      std::lock_guard<std::mutex> lock(cache::Depot::instance().mutex);
+      assertUnit(spare >= 100);
+      assertUnit(cache::Depot::instance().count == depot + spare);
+   }  // teardown
+
+   // an allocator that has not opted in gets its nodes straight back
+   void test_threadCache_optIn()
+   {  // setup
+      int live = StatelessHeap::live;
+      {
+         custom::list<int, StatelessAllocator<int>> l;
+         for (int i = 0; i < 10; i++)
+            l.push_back(i);
+         // exercise
+         l.clear();
+         // verify
+         assertUnit(StatelessHeap::live == live);
+      }
+      {
+         custom::list<int, CachedAllocator<int>> l;
+         for (int i = 0; i < 10; i++)
+            l.push_back(i);
+         l.clear();
+         assertUnit(StatelessHeap::live == live + 10);
+      }
+   }  // teardown
+
+   // a list destroyed after its thread's cache frees its own nodes
+   void test_threadCache_outlived()
+   {  // setup
+      using cache = custom::node_cache<std::allocator_traits<CachedAllocator<int>>::
+         rebind_alloc<custom::list<int, CachedAllocator<int>>::Node>>;
+      int live = 0;
+      int depot = 0;
+      // exercise
+      std::thread t([]()
+         {
+            // built before the cache, so it is destroyed after it
+            thread_local custom::list<int, CachedAllocator<int>> l;
+            for (int i = 0; i < 100; i++)
+               l.push_back(i);
+         });
+      t.join();
+      {
+         std::lock_guard<std::mutex> lock(cache::Depot::instance().mutex);
+         depot = (int)cache::Depot::instance().count;
+      }
+      live = StatelessHeap::live;
+      // verify
+      assertUnit(cache::size() <= cache::threadLimit);
+      assertUnit(live == depot + (int)cache::size());
+   }  // teardown
+
+   /***************************************
+    * MEMORY RESOURCE
+    ***************************************/
+
+   // a request-scoped list lives entirely in a stack buffer. Both the
+   // upstream and the default resource refuse to allocate, and the
+   // global operator new and delete are counted, so no trip to the heap
+   // can go unnoticed
+   void test_pmr_requestScoped()
+   {  // setup
+      char buffer[4096];
+      std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                                   std::pmr::null_memory_resource());
+      std::pmr::memory_resource* pDefault =
+         std::pmr::set_default_resource(std::pmr::null_memory_resource());
+      const int a[] = { 11, 26, 31 };
+      bool heap = false;
+      bool inBuffer = false;
+      size_t sizes[3] = { 99, 99, 99 };
+      size_t calls = GlobalHeap::calls;
+      // exercise
+      try
+      {
+         custom::pmr::list<int> l1(&resource);
+         custom::pmr::list<int> l2(size_t(3), int(99), &resource);
+         custom::pmr::list<int> l3(a, a + 3, &resource);
+         l1.push_back(int(11));
+         l1.push_front(int(26));
+         l1.insert(l1.begin(), int(31));
+         l1.erase(l1.begin());
+         l1.pop_back();
+         l2.pop_front();
+         l1.clear();
+         sizes[0] = l1.size();
+         sizes[1] = l2.size();
+         sizes[2] = l3.size();
+         inBuffer = std::less<void*>()(l3.sentinel.pNext, buffer + sizeof(buffer)) &&
+                   !std::less<void*>()(l3.sentinel.pNext, buffer);
+      }
+      catch (const std::bad_alloc&)
+      {
+         heap = true;
+      }
+      calls = GlobalHeap::calls - calls;
+      std::pmr::set_default_resource(pDefault);
+      // verify
+      assertUnit(calls == 0);
+      assertUnit(!heap);
+      assertUnit(sizes[0] == 0);
+      assertUnit(sizes[1] == 2);
+      assertUnit(sizes[2] == 3);
+      assertUnit(inBuffer);
+   }  // teardown
+
+   // the assignment operators keep each list on its own resource
+   void test_pmr_assign()
+   {  // setup
+      char buffer[4096];
+      std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                                   std::pmr::null_memory_resource());
+      custom::pmr::list<int> lSrc({ 11, 26, 31 }, &resource);
+      custom::pmr::list<int> lDest(&resource);
+      // exercise
+      lDest = lSrc;
+      lSrc = { 42, 57 };
+      // verify
+      assertUnit(lDest.get_allocator().resource() == &resource);
+      assertUnit(lDest.size() == 3);
+      assertUnit(lDest.front() == 11);
+      assertUnit(lDest.back() == 31);
+      assertUnit(lSrc.size() == 2);
+      assertUnit(lSrc.front() == 42);
+      assertUnit(lSrc.back() == 57);
+   }  // teardown
+
+   // moving between resources copies the elements instead of the nodes
+   void test_pmr_moveBetweenResources()
+   {  // setup
+      std::pmr::unsynchronized_pool_resource resourceSrc;
+      std::pmr::unsynchronized_pool_resource resourceDest;
+      custom::pmr::list<int> lSrc({ 11, 26, 31 }, &resourceSrc);
+      custom::pmr::list<int> lDest(&resourceDest);
+      custom::pmr::list<int>::Link* p = lSrc.sentinel.pNext;
+      // exercise
+      lDest = std::move(lSrc);
+      // verify
+      assertUnit(lDest.get_allocator().resource() == &resourceDest);
+      assertUnit(lDest.sentinel.pNext != p);
+      assertUnit(lDest.size() == 3);
+      assertUnit(lDest.front() == 11);
+      assertUnit(lDest.back() == 31);
+      assertUnit(lSrc.empty());
+   }  // teardown
+
+   /***************************************
+    * EMPLACE
+    ***************************************/
+
+   // emplace in the middle of the standard fixture
+   void test_emplace_standardMiddle()
+   {  // setup
+      //    +----+   +----+   +----+
+      //    | 11 | - | 26 | - | 31 |
+      //    +----+   +----+   +----+
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator it(l.sentinel.pNext->pNext);
+      // exercise
+      it = l.emplace(it, 99);
+      // verify
+      //    +----+   +----+   +----+   +----+
+      //    | 11 | - | 99 | - | 26 | - | 31 |
+      //    +----+   +----+   +----+   +----+
+      assertUnit(l.numElements == 4);
+      assertUnit(it.p == l.sentinel.pNext->pNext);
+      assertUnit(*it == 99);
+      assertUnit(it.p->pPrev == l.sentinel.pNext);
+      assertUnit(it.p->pNext->node()->data == 26);
+      assertUnit(it.p->pNext->pPrev == it.p);
+      // teardown
+      l.sentinel.pNext->pNext = it.p->pNext;
+      it.p->pNext->pPrev = l.sentinel.pNext;
+      l.numElements = 3;
+      it.p->pNext = it.p->pPrev = nullptr;
+      l.deleteNode(it.p->node());
+      teardownStandardFixture(l);
+   }
+
+   // the element is built inside the node from its arguments
+   void test_emplaceBack_noCopies()
+   {  // setup
+      custom::list<Tally> l;
+      Tally::transfers = 0;
+      // exercise
+      l.emplace_back(11, 26);
+      Tally& t = l.emplace_back(31, 42);
+      // verify
+      assertUnit(Tally::transfers == 0);
+      assertUnit(l.size() == 2);
+      assertUnit(&t == &l.sentinel.pPrev->node()->data);
+      assertUnit(l.sentinel.pNext->node()->data.a == 11);
+      assertUnit(l.sentinel.pNext->node()->data.b == 26);
+      assertUnit(l.sentinel.pPrev->node()->data.a == 31);
+      assertUnit(l.sentinel.pPrev->node()->data.b == 42);
+      assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+      assertUnit(l.sentinel.pPrev->pPrev == l.sentinel.pNext);
+   }  // teardown
+
+   // emplace onto the front of an empty list
+   void test_emplaceFront_empty()
+   {  // setup
+      custom::list<int> l;
+      // exercise
+      int& data = l.emplace_front(99);
+      // verify
+      assertUnit(data == 99);
+      assertUnit(l.numElements == 1);
+      assertUnit(l.sentinel.pNext != &l.sentinel);
+      assertUnit(l.sentinel.pNext == l.sentinel.pPrev);
+      assertUnit(l.sentinel.pNext->pNext == &l.sentinel);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+   }  // teardown
+
+   // a payload that can be moved but never copied
+   void test_emplace_moveOnly()
+   {  // setup
+      custom::list<std::unique_ptr<int>> l;
+      // exercise
+      l.emplace_back(new int(26));
+      l.emplace_front(new int(11));
+      l.push_back(std::make_unique<int>(31));
+      // verify
+      assertUnit(l.size() == 3);
+      assertUnit(*l.front() == 11);
+      assertUnit(*l.sentinel.pNext->pNext->node()->data == 26);
+      assertUnit(*l.back() == 31);
+   }  // teardown
+
+   /***************************************
+    * SWAP
+    ***************************************/
+
+   // swap the standard fixture with an empty list
+   void test_swap_standardEmpty()
+   {  // setup
+      custom::list<int> lLHS;
+      custom::list<int> lRHS;
+      setupStandardFixture(lLHS);
+      custom::list<int>::Link* pHead = lLHS.sentinel.pNext;
+      custom::list<int>::Link* pTail = lLHS.sentinel.pPrev;
+      // exercise
+      lLHS.swap(lRHS);
+      // verify
+      assertEmptyFixture(lLHS);
+      assertStandardFixture(lRHS);
+      assertUnit(lRHS.sentinel.pNext == pHead);
+      assertUnit(lRHS.sentinel.pPrev == pTail);
+      // teardown
+      teardownStandardFixture(lRHS);
+   }
+
+   // the free swap is found by argument dependent lookup
+   void test_swap_adl()
+   {  // setup
+      custom::list<int> lLHS{ 11, 26, 31 };
+      custom::list<int> lRHS{ 99 };
+      custom::list<int>::Link* p = lRHS.sentinel.pNext;
+      // exercise
+      using std::swap;
+      swap(lLHS, lRHS);
+      // verify
+      assertUnit(lLHS.size() == 1);
+      assertUnit(lLHS.sentinel.pNext == p);
+      assertStandardFixture(lRHS);
+   }  // teardown
+
+   // block nodes are freed by whoever ends up holding them
+   void test_swap_blocks()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> lLHS(size_t(3), int(99), CountingAllocator<int>(&live));
+         custom::list<int, CountingAllocator<int>> lRHS{ CountingAllocator<int>(&live) };
+         lRHS.set_node_recycling(10);
+         lRHS.push_back(int(11));
+         lRHS.pop_back();
+         // exercise
+         lLHS.swap(lRHS);
+         // verify
+         assertUnit(lLHS.empty());
+         assertUnit(lLHS.cached_nodes() == 1);
+         assertUnit(lRHS.size() == 3);
+         assertUnit(lRHS.blocks.size() == 1);
+         assertUnit(lLHS.blocks.empty());
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // containers of lists move them rather than copy them
+   void test_move_noexcept()
+   {  // setup
+      std::vector<custom::list<int>> v;
+      v.push_back(custom::list<int>{ 11, 26, 31 });
+      custom::list<int>::Link* p = v[0].sentinel.pNext;
+      // exercise
+      for (int i = 0; i < 100; i++)
+         v.push_back(custom::list<int>());
+      // verify
+      assertUnit(std::is_nothrow_move_constructible<custom::list<int>>::value);
+      assertUnit(std::is_nothrow_move_assignable<custom::list<int>>::value);
+      assertUnit(v[0].sentinel.pNext == p);
+      assertStandardFixture(v[0]);
+   }  // teardown
+
+   /***************************************
+    * SORT
+    ***************************************/
+
+   // sorting an empty list does nothing
+   void test_sort_empty()
+   {  // setup
+      custom::list<int> l;
+      // exercise
+      l.sort();
+      // verify
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // sort the standard fixture from back to front by moving the nodes
+   void test_sort_standardReversed()
+   {  // setup
+      //       +----+   +----+   +----+
+      //       | 31 | - | 26 | - | 11 |
+      //       +----+   +----+   +----+
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::Link* p11 = l.sentinel.pNext;
+      custom::list<int>::Link* p31 = l.sentinel.pPrev;
+      p11->node()->data = 31;
+      p31->node()->data = 11;
+      // exercise
+      l.sort();
+      // verify
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      assertStandardFixture(l);
+      assertUnit(l.sentinel.pNext == p31);
+      assertUnit(l.sentinel.pPrev == p11);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // sort with a comparison of our own
+   void test_sort_compare()
+   {  // setup
+      custom::list<int> l{ 26, 11, 31 };
+      // exercise
+      l.sort(std::greater<int>());
+      // verify
+      auto it = l.begin();
+      assertUnit(*it == 31);
+      ++it;
+      assertUnit(*it == 26);
+      ++it;
+      assertUnit(*it == 11);
+      ++it;
+      assertUnit(it == l.end());
+      assertUnit(l.sentinel.pPrev->node()->data == 11);
+   }  // teardown
+
+   // equal elements stay in the order they came in
+   void test_sort_stable()
+   {  // setup
+      custom::list<Tally> l;
+      int keys[] = { 3, 1, 2, 1, 3, 2, 1 };
+      for (int i = 0; i < 7; i++)
+         l.emplace_back(keys[i], i);
+      // exercise
+      l.sort([](const Tally& lhs, const Tally& rhs) { return lhs.a < rhs.a; });
+      // verify
+      int expected[] = { 1, 3, 6, 2, 5, 0, 4 };
+      int i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, i++)
+         assertUnit(i < 7 && it->b == expected[i]);
+      assertUnit(i == 7);
+   }  // teardown
+
+   // a big shuffled list comes out like std::sort, without allocating
+   void test_sort_large()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+      std::vector<int> v;
+      for (int i = 0; i < 1000; i++)
+      {
+         v.push_back((i * 7919) % 1009);
+         l.push_back(v.back());
+      }
+      int liveBefore = live;
+      // exercise
+      l.sort();
+      // verify
+      std::sort(v.begin(), v.end());
+      assertUnit(live == liveBefore);
+      assertUnit(l.size() == 1000);
+      bool same = true;
+      size_t i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         same = same && *it == v[i++];
+      assertUnit(same);
+      size_t back = 0;
+      for (auto it = l.rbegin(); it != l.rend(); ++it)
+         back++;
+      assertUnit(back == 1000);
+   }  // teardown
+
+   // a comparison that throws leaves every element in the list
+   void test_sort_throw()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(100 - i);
+      int count = 0;
+      // exercise
+      bool thrown = false;
+      try
+      {
+         l.sort([&count](int lhs, int rhs)
+         {
+            if (++count == 300)
+               throw 99;
+            return lhs < rhs;
+         });
+      }
+      catch (int)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(l.size() == 100);
+      int sum = 0;
+      size_t num = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, num++)
+         sum += *it;
+      assertUnit(num == 100);
+      assertUnit(sum == 5050);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+   }  // teardown
+
+   // a list too short to share out is sorted right here
+   void test_parallelSort_small()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      l.sentinel.pNext->node()->data = 31;
+      l.sentinel.pPrev->node()->data = 11;
+      // exercise
+      custom::parallel_sort(l);
+      // verify
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // four threads come out the same as std::sort, without allocating nodes
+   void test_parallelSort_large()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+      std::vector<int> v;
+      for (int i = 0; i < 100000; i++)
+      {
+         v.push_back((i * 7919) % 10007);
+         l.push_back(v.back());
+      }
+      int liveBefore = live;
+      // exercise
+      l.parallel_sort(std::less<int>(), 4);
+      // verify
+      std::sort(v.begin(), v.end());
+      assertUnit(live == liveBefore);
+      assertUnit(l.size() == v.size());
+      bool same = true;
+      size_t i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         same = same && *it == v[i++];
+      assertUnit(same && i == v.size());
+      same = true;
+      for (auto it = l.rbegin(); it != l.rend(); ++it)
+         same = same && *it == v[--i];
+      assertUnit(same && i == 0);
+   }  // teardown
+
+   // three runs, so one waits out the first round of merging, and ties stay in order
+   void test_parallelSort_oddRuns()
+   {  // setup
+      custom::list<Tally> l;
+      for (int i = 0; i < 60000; i++)
+         l.emplace_back(i % 7, i);
+      // exercise
+      custom::parallel_sort(l, [](const Tally& lhs, const Tally& rhs) { return lhs.a < rhs.a; });
+      l.parallel_sort([](const Tally& lhs, const Tally& rhs) { return lhs.a < rhs.a; }, 3);
+      // verify
+      bool ordered = true;
+      const Tally* pPrev = nullptr;
+      for (auto it = l.begin(); it != l.end(); ++it)
+      {
+         if (pPrev)
+            ordered = ordered && (pPrev->a < it->a || (pPrev->a == it->a && pPrev->b < it->b));
+         pPrev = &*it;
+      }
+      assertUnit(ordered);
+      assertUnit(l.size() == 60000);
+   }  // teardown
+
+   // a comparison that throws on one thread leaves every element in the list
+   void test_parallelSort_throw()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 50000; i++)
+         l.push_back(i % 1000);
+      // exercise
+      bool thrown = false;
+      try
+      {
+         l.parallel_sort([](int lhs, int rhs)
+         {
+            if (lhs == 999 && rhs == 998)
+               throw 99;
+            return lhs < rhs;
+         }, 3);
+      }
+      catch (int)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      long long sum = 0;
+      size_t num = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, num++)
+         sum += *it;
+      assertUnit(num == 50000);
+      assertUnit(sum == 50LL * 999 * 1000 / 2);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+   }  // teardown
+
+   // unsigned values spread over every byte come out like std::sort
+   void test_radixSort_unsigned()
+   {  // setup
+      int live = 0;
+      custom::list<uint64_t, CountingAllocator<uint64_t>> l{ CountingAllocator<uint64_t>(&live) };
+      std::vector<uint64_t> v;
+      uint64_t x = 88172645463325252ULL;
+      for (int i = 0; i < 1000; i++)
+      {
+         x ^= x << 13;
+         x ^= x >> 7;
+         x ^= x << 17;
+         v.push_back(x);
+         l.push_back(x);
+      }
+      int liveBefore = live;
+      // exercise
+      radix_sort(l);
+      // verify
+      std::sort(v.begin(), v.end());
+      assertUnit(live == liveBefore);
+      assertUnit(l.size() == 1000);
+      bool same = true;
+      size_t i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it)
+         same = same && *it == v[i++];
+      assertUnit(same);
+      size_t back = 0;
+      for (auto it = l.rbegin(); it != l.rend(); ++it)
+         back++;
+      assertUnit(back == 1000);
+   }  // teardown
+
+   // negative keys go before the positive ones
+   void test_radixSort_signed()
+   {  // setup
+      custom::list<int> l;
+      int values[] = { 5, -3, 0, -300000, 70000, -1, 2 };
+      for (int i = 0; i < 7; i++)
+         l.push_back(values[i]);
+      // exercise
+      l.radix_sort();
+      // verify
+      int expected[] = { -300000, -3, -1, 0, 2, 5, 70000 };
+      int i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, i++)
+         assertUnit(i < 7 && *it == expected[i]);
+      assertUnit(i == 7);
+      assertUnit(l.sentinel.pPrev->node()->data == 70000);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+   }  // teardown
+
+   // sorting by a key keeps equal keys in order and copies nothing
+   void test_radixSort_key()
+   {  // setup
+      custom::list<Tally> l;
+      int keys[] = { 3, 1, 2, 1, 3, 2, 1 };
+      for (int i = 0; i < 7; i++)
+         l.emplace_back(keys[i] * 1000, i);
+      Tally::transfers = 0;
+      // exercise
+      radix_sort(l, [](const Tally& t) { return t.a; });
+      // verify
+      int expected[] = { 1, 3, 6, 2, 5, 0, 4 };
+      int i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, i++)
+         assertUnit(i < 7 && it->b == expected[i]);
+      assertUnit(i == 7);
+      assertUnit(Tally::transfers == 0);
+   }  // teardown
+
+   // a key that throws part way through the second pass leaves every element in the list
+   void test_radixSort_throw()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back((i * 37) % 100 * 1000);
+      int calls = 0;
+      // exercise
+      bool thrown = false;
+      try
+      {
+         l.radix_sort([&calls](int t)
+         {
+            if (++calls == 150)
+               throw 99;
+            return t;
+         });
+      }
+      catch (int)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      int sum = 0;
+      size_t num = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, num++)
+         sum += *it;
+      assertUnit(num == 100);
+      assertUnit(sum == 99 * 100 / 2 * 1000);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+   }  // teardown
+
+   /***************************************
+    * SPLICE
+    ***************************************/
+
+   // every node of the other list moves over, in place
+   void test_splice_all()
+   {  // setup
+      custom::list<int> lLHS{ 11, 99 };
+      custom::list<int> lRHS{ 26, 31 };
+      custom::list<int>::Link* p26 = lRHS.sentinel.pNext;
+      custom::list<int>::Link* p31 = lRHS.sentinel.pPrev;
+      // exercise
+      lLHS.splice(++lLHS.begin(), lRHS);
+      // verify
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) == std::vector<int>({ 11, 26, 31, 99 }));
+      assertUnit(lLHS.size() == 4);
+      assertUnit(lLHS.sentinel.pNext->pNext == p26);
+      assertUnit(p26->pNext == p31);
+      assertUnit(p31->pNext == lLHS.sentinel.pPrev);
+      assertUnit(lLHS.sentinel.pPrev->pPrev == p31);
+      assertUnit(lRHS.empty());
+      assertEmptyFixture(lRHS);
+   }  // teardown
+
+   // splicing to the end of an empty list, or from one, just works
+   void test_splice_allEmpty()
+   {  // setup
+      custom::list<int> lLHS;
+      custom::list<int> lRHS{ 26, 31 };
+      // exercise
+      lLHS.splice(lLHS.end(), lRHS);
+      lLHS.splice(lLHS.begin(), lRHS);
+      lLHS.splice(lLHS.end(), custom::list<int>{ 49 });
+      // verify
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) == std::vector<int>({ 26, 31, 49 }));
+      assertUnit(lLHS.size() == 3);
+      assertUnit(lLHS.sentinel.pNext->pPrev == &lLHS.sentinel);
+      assertUnit(lLHS.sentinel.pPrev->pNext == &lLHS.sentinel);
+      assertEmptyFixture(lRHS);
+   }  // teardown
+
+   // one element moves from a retry queue to the back of a ready queue
+   void test_splice_one()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> lReady({ 11, 26 }, CountingAllocator<int>(&live));
+      custom::list<int, CountingAllocator<int>> lRetry({ 31, 49, 67 }, CountingAllocator<int>(&live));
+      int liveBefore = live;
+      auto it = ++lRetry.begin();
+      // exercise
+      lReady.splice(lReady.end(), lRetry, it);
+      // verify
+      assertUnit(live == liveBefore);
+      assertUnit(std::vector<int>(lReady.begin(), lReady.end()) == std::vector<int>({ 11, 26, 49 }));
+      assertUnit(std::vector<int>(lRetry.begin(), lRetry.end()) == std::vector<int>({ 31, 67 }));
+      assertUnit(lReady.size() == 3);
+      assertUnit(lRetry.size() == 2);
+      assertUnit(lReady.sentinel.pPrev == it.p);
+      assertUnit(it.p->pNext == &lReady.sentinel);
+   }  // teardown
+
+   // an element moves within its own list, including onto itself
+   void test_splice_oneSelf()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31 };
+      // exercise
+      l.splice(l.begin(), l, --l.end());
+      l.splice(l.begin(), l, l.begin());
+      l.splice(++(++l.begin()), l, l.begin());
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 31, 26 }));
+      assertUnit(l.size() == 3);
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 26, 31, 11 }));
+   }  // teardown
+
+   // a range moves across, counted or with the count supplied
+   void test_splice_range()
+   {  // setup
+      custom::list<int> lLHS{ 11, 99 };
+      custom::list<int> lRHS{ 26, 31, 49, 67 };
+      // exercise
+      lLHS.splice(++lLHS.begin(), lRHS, ++lRHS.begin(), --lRHS.end());
+      lLHS.splice(lLHS.end(), lRHS, lRHS.begin(), lRHS.end(), 2);
+      // verify
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) == std::vector<int>({ 11, 31, 49, 99, 26, 67 }));
+      assertUnit(lLHS.size() == 6);
+      assertUnit(std::vector<int>(lLHS.rbegin(), lLHS.rend()) == std::vector<int>({ 67, 26, 99, 49, 31, 11 }));
+      assertEmptyFixture(lRHS);
+   }  // teardown
+
+   // a range moves within its own list without changing the size
+   void test_splice_rangeSelf()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31, 49 };
+      // exercise
+      l.splice(l.begin(), l, ++(++l.begin()), l.end());
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 31, 49, 11, 26 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 26, 11, 49, 31 }));
+      assertUnit(l.size() == 4);
+   }  // teardown
+
+   // the registry stays in order of address as blocks come and go,
+   // so each node still finds the block it came from
+   void test_splice_manyBlocks()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> lLHS{ CountingAllocator<int>(&live) };
+         for (int i = 0; i < 20; i++)
+         {
+            custom::list<int, CountingAllocator<int>> lRHS(size_t(3), i, CountingAllocator<int>(&live));
+            lLHS.splice(i % 2 ? lLHS.begin() : lLHS.end(), lRHS);
+         }
+         // exercise
+         int liveFull = live;
+         lLHS.remove_if([](int i) { return i % 3 == 0; });
+         for (int i = 0; i < 10; i++)
+         {
+            lLHS.pop_front();
+            lLHS.pop_back();
+         }
+         // verify
+         bool sorted = true;
+         for (size_t i = 1; i < lLHS.blocks.size(); i++)
+            sorted = sorted && std::less<void*>()(lLHS.blocks[i - 1]->pNodes, lLHS.blocks[i]->pNodes);
+         assertUnit(sorted);
+         assertUnit(lLHS.size() == 19);
+         assertUnit(live < liveFull);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // nodes carved from a block outlive the list that built them
+   void test_splice_blocks()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> lLHS{ CountingAllocator<int>(&live) };
+         {
+            custom::list<int, CountingAllocator<int>> lRHS(size_t(4), int(99),
+                                                           CountingAllocator<int>(&live));
+            // exercise
+            lLHS.splice(lLHS.end(), lRHS, ++lRHS.begin(), lRHS.end(), 3);
+            assertUnit(lLHS.blocks.size() == 1);
+            assertUnit(lLHS.blocks[0]->owners == 2);
+         }
+         // verify
+         int liveAlone = live;
+         assertUnit(lLHS.size() == 3);
+         assertUnit(lLHS.blocks[0]->owners == 1);
+         lLHS.pop_front();
+         lLHS.pop_front();
+         assertUnit(live == liveAlone);
+         lLHS.pop_front();
+         assertUnit(live < liveAlone);      // the block went with its last node
+         assertUnit(lLHS.blocks.empty());
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   /***************************************
+    * MERGE
+    ***************************************/
+
+   // two sorted lists interleave without allocating
+   void test_merge_interleave()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> lLHS({ 11, 31, 49, 99 }, CountingAllocator<int>(&live));
+      custom::list<int, CountingAllocator<int>> lRHS({ 5, 6, 26, 67, 89, 100 }, CountingAllocator<int>(&live));
+      int liveBefore = live;
+      // exercise
+      lLHS.merge(lRHS);
+      // verify
+      assertUnit(live == liveBefore);
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) ==
+                 std::vector<int>({ 5, 6, 11, 26, 31, 49, 67, 89, 99, 100 }));
+      assertUnit(std::vector<int>(lLHS.rbegin(), lLHS.rend()) ==
+                 std::vector<int>({ 100, 99, 89, 67, 49, 31, 26, 11, 6, 5 }));
+      assertUnit(lLHS.size() == 10);
+      assertUnit(lRHS.empty());
+      assertUnit(lRHS.sentinel.pNext == &lRHS.sentinel);
+      assertUnit(lRHS.sentinel.pPrev == &lRHS.sentinel);
+   }  // teardown
+
+   // merging into or from an empty list, or with itself
+   void test_merge_empty()
+   {  // setup
+      custom::list<int> lLHS;
+      custom::list<int> lRHS{ 26, 31 };
+      custom::list<int> lEmpty;
+      // exercise
+      lLHS.merge(lRHS);
+      lLHS.merge(lEmpty);
+      lLHS.merge(lLHS);
+      // verify
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) == std::vector<int>({ 26, 31 }));
+      assertUnit(lLHS.size() == 2);
+      assertUnit(lLHS.sentinel.pPrev->pNext == &lLHS.sentinel);
+      assertEmptyFixture(lRHS);
+      assertEmptyFixture(lEmpty);
+   }  // teardown
+
+   // a temporary batch sorted the other way merges straight in
+   void test_merge_compareRvalue()
+   {  // setup
+      custom::list<int> l{ 99, 49, 11 };
+      // exercise
+      l.merge(custom::list<int>{ 67, 31, 26, 5 }, std::greater<int>());
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 99, 67, 49, 31, 26, 11, 5 }));
+      assertUnit(l.size() == 7);
+   }  // teardown
+
+   // equal elements keep ours ahead of theirs, and nothing is copied
+   void test_merge_stable()
+   {  // setup
+      custom::list<Tally> lLHS;
+      custom::list<Tally> lRHS;
+      int keysLHS[] = { 1, 2, 2, 4 };
+      int keysRHS[] = { 1, 2, 3, 4 };
+      for (int i = 0; i < 4; i++)
+      {
+         lLHS.emplace_back(keysLHS[i], i);
+         lRHS.emplace_back(keysRHS[i], i + 10);
+      }
+      Tally::transfers = 0;
+      // exercise
+      lLHS.merge(lRHS, [](const Tally& lhs, const Tally& rhs) { return lhs.a < rhs.a; });
+      // verify
+      int expected[] = { 0, 10, 1, 2, 11, 12, 3, 13 };
+      int i = 0;
+      for (auto it = lLHS.begin(); it != lLHS.end(); ++it, i++)
+         assertUnit(i < 8 && it->b == expected[i]);
+      assertUnit(i == 8);
+      assertUnit(Tally::transfers == 0);
+   }  // teardown
+
+   // a comparison that throws leaves every element in one list or the other
+   void test_merge_throw()
+   {  // setup
+      custom::list<int> lLHS{ 11, 31, 49 };
+      custom::list<int> lRHS{ 5, 26, 99 };
+      // exercise
+      bool thrown = false;
+      try
+      {
+         lLHS.merge(lRHS, [](int lhs, int rhs)
+         {
+            if (lhs == 99)
+               throw 99;
+            return lhs < rhs;
+         });
+      }
+      catch (int)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(std::vector<int>(lLHS.begin(), lLHS.end()) == std::vector<int>({ 5, 11, 31, 49 }));
+      assertUnit(lLHS.size() == 4);
+      assertUnit(std::vector<int>(lRHS.begin(), lRHS.end()) == std::vector<int>({ 26, 99 }));
+      assertUnit(lRHS.size() == 2);
+      assertUnit(lRHS.sentinel.pNext->pPrev == &lRHS.sentinel);
+   }  // teardown
+
+   /***************************************
+    * REMOVE and UNIQUE
+    ***************************************/
+
+   // every copy of a value goes, including at both ends
+   void test_remove_value()
+   {  // setup
+      custom::list<int> l{ 11, 26, 11, 31, 11 };
+      // exercise
+      size_t num = l.remove(11);
+      // verify
+      assertUnit(num == 3);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 26, 31 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 31, 26 }));
+      assertUnit(l.size() == 2);
+      assertUnit(l.remove(99) == 0);
+   }  // teardown
+
+   // the value may live in the list itself
+   void test_remove_ownElement()
+   {  // setup
+      custom::list<int> l{ 26, 11, 26, 26 };
+      // exercise
+      size_t num = l.remove(l.front());
+      // verify
+      assertUnit(num == 3);
+      assertUnit(l.size() == 1);
+      assertUnit(l.front() == 11);
+      assertUnit(l.sentinel.pNext == l.sentinel.pPrev);
+   }  // teardown
+
+   // the dropped nodes go back to the allocator
+   void test_removeIf_released()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+         for (int i = 0; i < 10; i++)
+            l.push_back(i);
+         int liveBefore = live;
+         // exercise
+         size_t num = l.remove_if([](int i) { return i % 2 == 1; });
+         // verify
+         assertUnit(num == 5);
+         assertUnit(live == liveBefore - 5);
+         assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 0, 2, 4, 6, 8 }));
+         assertUnit(l.remove_if([](int) { return true; }) == 5);
+         assertUnit(l.empty());
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // a predicate that throws still removes what it already matched
+   void test_removeIf_throw()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31, 49 };
+      // exercise
+      bool thrown = false;
+      try
+      {
+         l.remove_if([](int i)
+         {
+            if (i == 31)
+               throw 99;
+            return i == 26;
+         });
+      }
+      catch (int)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 31, 49 }));
+      assertUnit(l.size() == 3);
+   }  // teardown
+
+   // runs of equal elements shrink to one
+   void test_unique_default()
+   {  // setup
+      custom::list<int> l{ 11, 11, 26, 31, 31, 31, 11 };
+      custom::list<int> lEmpty;
+      // exercise
+      size_t num = l.unique();
+      // verify
+      assertUnit(num == 3);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 26, 31, 11 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 11, 31, 26, 11 }));
+      assertUnit(l.size() == 4);
+      assertUnit(lEmpty.unique() == 0);
+   }  // teardown
+
+   // each element is compared with the first of its run
+   void test_unique_predicate()
+   {  // setup
+      custom::list<int> l{ 10, 12, 14, 16, 30, 31 };
+      // exercise
+      size_t num = l.unique([](int lhs, int rhs) { return rhs - lhs < 5; });
+      // verify
+      assertUnit(num == 3);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 10, 16, 30 }));
+      assertUnit(l.sentinel.pPrev->node()->data == 30);
+   }  // teardown
+
+   /***************************************
+    * REVERSE
+    ***************************************/
+
+   // the nodes stay put, only their links flip
+   void test_reverse_standard()
+   {  // setup
+      int live = 0;
+      custom::list<int, CountingAllocator<int>> l({ 26, 49, 67, 89 }, CountingAllocator<int>(&live));
+      custom::list<int, CountingAllocator<int>>::Link* p26 = l.sentinel.pNext;
+      custom::list<int, CountingAllocator<int>>::Link* p89 = l.sentinel.pPrev;
+      int liveBefore = live;
+      // exercise
+      l.reverse();
+      // verify
+      assertUnit(live == liveBefore);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 89, 67, 49, 26 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 26, 49, 67, 89 }));
+      assertUnit(l.sentinel.pNext == p89);
+      assertUnit(l.sentinel.pPrev == p26);
+      assertUnit(p89->pPrev == &l.sentinel);
+      assertUnit(p26->pNext == &l.sentinel);
+      assertUnit(l.size() == 4);
+   }  // teardown
+
+   // nothing to flip in an empty list or a list of one
+   void test_reverse_emptyOne()
+   {  // setup
+      custom::list<int> lEmpty;
+      custom::list<int> lOne{ 26 };
+      // exercise
+      lEmpty.reverse();
+      lOne.reverse();
+      // verify
+      assertEmptyFixture(lEmpty);
+      assertUnit(lOne.size() == 1);
+      assertUnit(lOne.front() == 26);
+      assertUnit(lOne.sentinel.pNext == lOne.sentinel.pPrev);
+      assertUnit(lOne.sentinel.pNext->pNext == &lOne.sentinel);
+      assertUnit(lOne.sentinel.pNext->pPrev == &lOne.sentinel);
+   }  // teardown
+
+   /***************************************
+    * BULK INSERT
+    ***************************************/
+
+   // several copies of a value go in front of the iterator
+   void test_insert_fill()
+   {  // setup
+      custom::list<int> l{ 11, 99 };
+      // exercise
+      auto it = l.insert(++l.begin(), size_t(3), 26);
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 26, 26, 26, 99 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 99, 26, 26, 26, 11 }));
+      assertUnit(l.size() == 5);
+      assertUnit(it.p == l.sentinel.pNext->pNext);
+      assertUnit(l.insert(l.end(), size_t(0), 31) == l.end());
+   }  // teardown
+
+   // a range goes in at either end
+   void test_insert_range()
+   {  // setup
+      custom::list<int> l;
+      std::vector<int> v{ 26, 31 };
+      // exercise
+      auto it = l.insert(l.end(), v.begin(), v.end());
+      l.insert(l.begin(), v.rbegin(), v.rend());
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 31, 26, 26, 31 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 31, 26, 26, 31 }));
+      assertUnit(l.size() == 4);
+      assertUnit(*it == 26);
+      assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+      assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+   }  // teardown
+
+   // a braced list goes in the middle
+   void test_insert_initializer()
+   {  // setup
+      custom::list<int> l{ 11, 99 };
+      // exercise
+      auto it = l.insert(--l.end(), { 26, 31, 49 });
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 26, 31, 49, 99 }));
+      assertUnit(l.size() == 5);
+      assertUnit(*it == 26);
+   }  // teardown
+
+   // a range that can only be read once still goes in
+   void test_insert_inputRange()
+   {  // setup
+      custom::list<int> l{ 11, 99 };
+      std::istringstream in("26 31 49");
+      // exercise
+      auto it = l.insert(++l.begin(), std::istream_iterator<int>(in), std::istream_iterator<int>());
+      // verify
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 26, 31, 49, 99 }));
+      assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 99, 49, 31, 26, 11 }));
+      assertUnit(l.size() == 5);
+      assertUnit(*it == 26);
+   }  // teardown
+
+   // an element that fails to build leaves the list as it was
+   void test_insert_rangeThrow()
+   {  // setup
+      struct Fussy
+      {
+         Fussy() : i(0) { }
+         Fussy(int i) : i(i) { if (i < 0) throw i; }
+         int i;
+      };
+      int live = 0;
+      {
+         custom::list<Fussy, CountingAllocator<Fussy>> l{ CountingAllocator<Fussy>(&live) };
+         l.emplace_back(11);
+         l.emplace_back(99);
+         int liveBefore = live;
+         std::vector<int> v{ 26, 31, -1, 49 };
+         // exercise
+         bool thrown = false;
+         try
+         {
+            l.insert(++l.begin(), v.begin(), v.end());
+         }
+         catch (int)
+         {
+            thrown = true;
+         }
+         // verify
+         assertUnit(thrown);
+         assertUnit(live == liveBefore);
+         assertUnit(l.size() == 2);
+         assertUnit(l.front().i == 11);
+         assertUnit(l.back().i == 99);
+         assertUnit(l.sentinel.pNext->pNext == l.sentinel.pPrev);
+         assertUnit(l.sentinel.pPrev->pPrev == l.sentinel.pNext);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   /***************************************
+    * RANGE ERASE
+    ***************************************/
+
+   // a window out of the middle goes back to the allocator
+   void test_erase_rangeMiddle()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> l({ 11, 26, 31, 49, 99 }, CountingAllocator<int>(&live));
+         int liveBefore = live;
+         auto last = --l.end();
+         // exercise
+         auto it = l.erase(++l.begin(), last);
+         // verify
+         assertUnit(it == last);
+         assertUnit(live == liveBefore - 3);
+         assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 11, 99 }));
+         assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>({ 99, 11 }));
+         assertUnit(l.size() == 2);
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // everything from begin to end leaves an empty list
+   void test_erase_rangeAll()
+   {  // setup
+      custom::list<int> l{ 26, 49, 67, 89 };
+      // exercise
+      auto it = l.erase(l.begin(), l.end());
+      // verify
+      assertUnit(it == l.end());
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // an empty range changes nothing
+   void test_erase_rangeEmpty()
+   {  // setup
+      custom::list<int> l{ 26, 49 };
+      // exercise
+      auto it = l.erase(l.begin(), l.begin());
+      // verify
+      assertUnit(it == l.begin());
+      assertUnit(l.size() == 2);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 26, 49 }));
+   }  // teardown
+
+   // with recycling on, the erased nodes wait for the next insert
+   void test_erase_rangeRecycled()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31, 49 };
+      l.set_node_recycling(2);
+      // exercise
+      l.erase(l.begin(), --l.end());
+      // verify
+      assertUnit(l.size() == 1);
+      assertUnit(l.front() == 49);
+      assertUnit(l.cached_nodes() == 2);
+      assertUnit(l.sentinel.pNext == l.sentinel.pPrev);
+   }  // teardown
+
+   /***************************************
+    * POSITIONAL INDEX
+    ***************************************/
+
+   // does every position agree with a walk through the list?
+   template <class List>
+   bool positionsMatch(List& l)
+   {
+      if (l.pIndex && l.pIndex->size() != l.size())
+         return false;
+      size_t i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, i++)
+         if (l.index_of(it) != i || l.iterator_at(i) != it || &l.at(i) != &*it)
+            return false;
+      return i == l.size() && l.index_of(l.end()) == i && l.iterator_at(i) == l.end();
+   }
+
+   // without the index the positional calls walk the list
+   void test_index_walk()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31, 49, 67 };
+      // exercise
+      auto it = l.begin();
+      l.advance(it, 3);
+      // verify
+      assertUnit(!l.has_positional_index());
+      assertUnit(l.pIndex == nullptr);
+      assertUnit(*it == 49);
+      assertUnit(l.at(1) == 26);
+      assertUnit(l.at(4) == 67);
+      assertUnit(l.index_of(it) == 3);
+      l.advance(it, -2);
+      assertUnit(*it == 26);
+      assertUnit(positionsMatch(l));
+   }  // teardown
+
+   // positions past the end are refused either way
+   void test_index_outOfRange()
+   {  // setup
+      custom::list<int> l{ 11, 26 };
+      int thrown = 0;
+      // exercise
+      for (int on = 0; on < 2; on++)
+      {
+         l.set_positional_index(on == 1);
+         try { l.at(2); } catch (const std::out_of_range&) { thrown++; }
+         try { l.iterator_at(3); } catch (const std::out_of_range&) { thrown++; }
+      }
+      // verify
+      assertUnit(thrown == 4);
+      assertUnit(l.iterator_at(2) == l.end());
+   }  // teardown
+
+   // the index follows every push, pop, insert and erase
+   void test_index_insertErase()
+   {  // setup
+      custom::list<int> l;
+      l.set_positional_index(true);
+      std::vector<int> v;
+      // exercise
+      for (int i = 0; i < 500; i++)
+      {
+         size_t pos = (size_t(i) * 7919) % (v.size() + 1);
+         l.insert(l.iterator_at(pos), i);
+         v.insert(v.begin() + pos, i);
+         if (i % 3 == 0)
+         {
+            size_t del = (size_t(i) * 104729) % v.size();
+            l.erase(l.iterator_at(del));
+            v.erase(v.begin() + del);
+         }
+      }
+      l.push_front(-1);
+      l.push_back(-2);
+      l.pop_front();
+      l.pop_back();
+      l.pop_front();
+      v.erase(v.begin());
+      // verify
+      assertUnit(l.has_positional_index());
+      assertUnit(std::vector<int>(l.begin(), l.end()) == v);
+      bool same = true;
+      for (size_t i = 0; i < v.size(); i++)
+         same = same && l.at(i) == v[i];
+      assertUnit(same);
+      assertUnit(positionsMatch(l));
+   }  // teardown
+
+   // sorting, reversing and filtering reshape the index
+   void test_index_reorder()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 200; i++)
+         l.push_back((i * 37) % 101);
+      l.set_positional_index(true);
+      // exercise and verify
+      l.sort();
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(0) == 0 && l.at(199) == 100);
+      l.reverse();
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(0) == 100);
+      l.radix_sort();
+      assertUnit(positionsMatch(l));
+      l.unique();
+      assertUnit(positionsMatch(l));
+      assertUnit(l.size() == 101);
+      l.remove_if([](int i) { return i % 2 == 0; });
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(10) == 21);
+      l.parallel_sort(std::greater<int>(), 2);
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(0) == 99);
+   }  // teardown
+
+   // range insert, range erase, clear and turning it off again
+   void test_index_bulk()
+   {  // setup
+      custom::list<int> l{ 11, 99 };
+      l.set_positional_index(true);
+      // exercise and verify
+      l.insert(l.iterator_at(1), { 26, 31, 49, 67 });
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(2) == 31);
+      l.insert(l.end(), size_t(3), 89);
+      assertUnit(positionsMatch(l));
+      l.erase(l.iterator_at(2), l.iterator_at(6));
+      assertUnit(positionsMatch(l));
+      assertUnit(l.size() == 5);
+      assertUnit(l.at(2) == 89);
+      l.clear();
+      assertUnit(positionsMatch(l));
+      l.push_back(26);
+      assertUnit(positionsMatch(l));
+      l.set_positional_index(false);
+      assertUnit(l.pIndex == nullptr);
+      assertUnit(positionsMatch(l));
+   }  // teardown
+
+   // nodes moving between lists leave one index and join the other
+   void test_index_splice()
+   {  // setup
+      custom::list<int> lLHS{ 11, 26, 31 };
+      custom::list<int> lRHS{ 49, 67, 89, 99 };
+      lLHS.set_positional_index(true);
+      lRHS.set_positional_index(true);
+      custom::list<int> lPlain{ 5, 6 };
+      // exercise and verify
+      lLHS.splice(lLHS.iterator_at(1), lRHS, lRHS.iterator_at(2));
+      assertUnit(positionsMatch(lLHS) && positionsMatch(lRHS));
+      assertUnit(lLHS.at(1) == 89);
+      lLHS.splice(lLHS.end(), lRHS, lRHS.begin(), lRHS.end());
+      assertUnit(positionsMatch(lLHS) && positionsMatch(lRHS));
+      assertUnit(lLHS.at(5) == 67);
+      lLHS.splice(lLHS.begin(), lLHS, lLHS.iterator_at(4), lLHS.end());
+      assertUnit(positionsMatch(lLHS));
+      assertUnit(lLHS.at(0) == 49);
+      lLHS.splice(lLHS.iterator_at(2), lPlain);
+      assertUnit(positionsMatch(lLHS) && positionsMatch(lPlain));
+      assertUnit(lLHS.at(2) == 5);
+      lPlain.splice(lPlain.end(), lLHS, lLHS.begin());
+      assertUnit(positionsMatch(lLHS) && positionsMatch(lPlain));
+      assertUnit(lLHS.size() == 8 && lLHS.pIndex->size() == 8);
+   }  // teardown
+
+   // merging moves every node of theirs into our index
+   void test_index_merge()
+   {  // setup
+      custom::list<int> lLHS{ 11, 31, 49, 99 };
+      custom::list<int> lRHS{ 5, 26, 67, 89 };
+      lLHS.set_positional_index(true);
+      lRHS.set_positional_index(true);
+      // exercise
+      lLHS.merge(lRHS);
+      // verify
+      assertUnit(positionsMatch(lLHS));
+      assertUnit(positionsMatch(lRHS));
+      assertUnit(lLHS.at(3) == 31);
+      assertUnit(lRHS.pIndex->size() == 0);
+   }  // teardown
+
+   // the index goes wherever the nodes go
+   void test_index_moveSwap()
+   {  // setup
+      custom::list<int> lLHS{ 11, 26 };
+      custom::list<int> lRHS{ 31, 49, 67 };
+      lRHS.set_positional_index(true);
+      // exercise
+      lLHS.swap(lRHS);
+      custom::list<int> lMoved(std::move(lLHS));
+      lRHS = std::move(lMoved);
+      // verify
+      assertUnit(lLHS.pIndex == nullptr);
+      assertUnit(lMoved.pIndex == nullptr);
+      assertUnit(lRHS.has_positional_index());
+      assertUnit(positionsMatch(lRHS));
+      assertUnit(lRHS.at(2) == 67);
+   }  // teardown
+
+   // an index goes back to the allocator that made it, even when
+   // assignment brings in another one
+   void test_index_assignAllocator()
+   {  // setup
+      using List = custom::list<int, PropagatingAllocator<int>>;
+      int liveLHS = 0;
+      int liveRHS = 0;
+      {
+         List lCopy({ 11, 26 }, PropagatingAllocator<int>(&liveLHS));
+         List lMove({ 11, 26 }, PropagatingAllocator<int>(&liveLHS));
+         List lSrc({ 31, 49, 67 }, PropagatingAllocator<int>(&liveRHS));
+         lCopy.set_positional_index(true);
+         lMove.set_positional_index(true);
+         // exercise
+         lCopy = lSrc;
+         lMove = std::move(lSrc);
+         // verify
+         assertUnit(liveLHS == 0);
+         assertUnit(lCopy.has_positional_index());
+         assertUnit(positionsMatch(lCopy));
+         assertUnit(lCopy.at(2) == 67);
+         assertUnit(!lMove.has_positional_index());
+         assertUnit(lMove.size() == 3);
+      }
+      assertUnit(liveLHS == 0);
+      assertUnit(liveRHS == 0);
+   }  // teardown
+
+   /***************************************
+    * COMPACT
+    ***************************************/
+
+   // after churn every node sits right after the one before it
+   void test_compact_churned()
+   {  // setup
+      int live = 0;
+      {
+         custom::list<int, CountingAllocator<int>> l{ CountingAllocator<int>(&live) };
+         for (int i = 0; i < 100; i++)
+         {
+            l.push_back(i);
+            l.push_front(-i);
+         }
+         l.remove_if([](int i) { return i % 3 == 0; });
+         std::vector<int> v(l.begin(), l.end());
+         int liveBefore = live;
+         // exercise
+         l.compact();
+         // verify
+         assertUnit(std::vector<int>(l.begin(), l.end()) == v);
+         assertUnit(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>(v.rbegin(), v.rend()));
+         assertUnit(l.size() == v.size());
+         bool contiguous = true;
+         for (auto p = l.sentinel.pNext; p->pNext != &l.sentinel; p = p->pNext)
+            contiguous = contiguous && p->pNext->node() == p->node() + 1;
+         assertUnit(contiguous);
+         assertUnit(l.sentinel.pNext->pPrev == &l.sentinel);
+         assertUnit(l.sentinel.pPrev->pNext == &l.sentinel);
+         assertUnit(live < liveBefore);
+         l.push_back(99);
+         l.pop_front();
+      }
+      assertUnit(live == 0);
+   }  // teardown
+
+   // nothing to move in an empty list
+   void test_compact_empty()
+   {  // setup
+      custom::list<int> l;
+      // exercise
+      l.compact();
+      auto it = l.compact(l.begin(), 10);
+      // verify
+      assertUnit(it == l.end());
+      assertUnit(l.blocks.empty());
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // elements that cannot be copied are moved
+   void test_compact_moveOnly()
+   {  // setup
+      custom::list<std::unique_ptr<int>> l;
+      for (int i = 0; i < 5; i++)
+         l.push_back(std::make_unique<int>(i));
+      int* p = l.back().get();
+      // exercise
+      l.compact();
+      // verify
+      assertUnit(l.size() == 5);
+      assertUnit(l.back().get() == p);
+      int i = 0;
+      for (auto it = l.begin(); it != l.end(); ++it, i++)
+         assertUnit(**it == i);
+   }  // teardown
+
+   // a few nodes per call, the whole pass in one block
+   void test_compact_incremental()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 10; i++)
+         l.push_front(i);
+      // exercise
+      int calls = 0;
+      for (auto it = l.begin(); it != l.end(); calls++)
+         it = l.compact(it, 4);
+      // verify
+      assertUnit(calls == 3);
+      assertUnit(l.blocks.size() == 1);
+      assertUnit(l.pFill == nullptr);
+      assertUnit(std::vector<int>(l.begin(), l.end()) == std::vector<int>({ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }));
+      bool contiguous = true;
+      for (auto p = l.sentinel.pNext; p->pNext != &l.sentinel; p = p->pNext)
+         contiguous = contiguous && p->pNext->node() == p->node() + 1;
+      assertUnit(contiguous);
+   }  // teardown
+
+   // a list that grows during a pass needs one more block, not one per call
+   void test_compact_grown()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 8; i++)
+         l.push_back(i);
+      auto it = l.compact(l.begin(), 4);
+      for (int i = 8; i < 16; i++)
+         l.push_back(i);
+      // exercise
+      while (it != l.end())
+         it = l.compact(it, 2);
+      // verify
+      assertUnit(l.blocks.size() == 2);
+      int i = 0;
+      for (auto itCheck = l.begin(); itCheck != l.end(); ++itCheck, i++)
+         assertUnit(*itCheck == i);
+      assertUnit(i == 16);
+      assertUnit(l.iterator_at(7).p->node() == l.iterator_at(0).p->node() + 7);
+      assertUnit(l.iterator_at(11).p->node() == l.iterator_at(8).p->node() + 3);
+   }  // teardown
+
+   // a pass that starts part way only takes room for what it moves
+   void test_compact_midList()
+   {  // setup
+      custom::list<int> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      auto it = l.iterator_at(50);
+      // exercise
+      it = l.compact(it, 10);
+      // verify
+      assertUnit(l.blocks.size() == 1);
+      assertUnit(l.blocks[0]->capacity == 10);
+      it = l.compact(it, 10);
+      it = l.compact(it, 10);
+      assertUnit(l.blocks.size() == 2);
+      assertUnit(l.pFill->capacity == 20);
+      assertUnit(*it == 80);
+      int i = 0;
+      for (auto itCheck = l.begin(); itCheck != l.end(); ++itCheck, i++)
+         assertUnit(*itCheck == i);
+      assertUnit(i == 100);
+   }  // teardown
+
+   // the old nodes go back to the allocator, not to the thread cache
+   void test_compact_threadCache()
+   {  // setup
+      using cache = custom::node_cache<std::allocator<custom::list<int>::Node>>;
+      custom::list<int> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      size_t spare = cache::size();
+      // exercise
+      l.compact();
+      // verify
+      assertUnit(cache::size() == spare);
+      assertUnit(l.blocks.size() == 1);
+      assertUnit(l.size() == 100);
+   }  // teardown
+
+   // the positional index follows the nodes to their new home
+   void test_compact_index()
+   {  // setup
+      custom::list<int> l{ 11, 26, 31, 49, 67 };
+      l.set_positional_index(true);
+      // exercise
+      auto it = l.compact(l.iterator_at(1), 2);
+      // verify
+      assertUnit(*it == 49);
+      assertUnit(positionsMatch(l));
+      l.compact();
+      assertUnit(positionsMatch(l));
+      assertUnit(l.at(3) == 49);
+   }  // teardown
+
    /****************************************************************
     * Setup Standard Fixture
     *        pHead             pTail
@@ -1901,15 +4168,17 @@ public:
       custom::list<int>::Node* p2 = new custom::list<int>::Node(int(26));
       custom::list<int>::Node* p3 = new custom::list<int>::Node(int(31));
 
-      // hook up pointers
+      // hook up pointers, the ends to the sentinel
       p1->pNext = p2;
       p2->pNext = p3;
+      p3->pNext = &l.sentinel;
       p3->pPrev = p2;
       p2->pPrev = p1;
+      p1->pPrev = &l.sentinel;
 
       // set up the list
-      l.pHead = p1;
-      l.pTail = p3;
+      l.sentinel.pNext = p1;
+      l.sentinel.pPrev = p3;
       l.numElements = 3;
    }
 
@@ -1922,24 +4191,24 @@ public:
     ****************************************************************/
    void teardownStandardFixture(custom::list<int>& l)
    {
-      if (l.pHead != NULL)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         if (l.pHead->pNext && l.pHead->pNext != l.pHead)
+         if (l.sentinel.pNext->pNext != &l.sentinel && l.sentinel.pNext->pNext != l.sentinel.pNext)
          {
-            if (l.pHead->pNext->pNext && l.pHead->pNext->pNext != l.pHead && l.pHead->pNext->pNext != l.pHead->pNext)
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel && l.sentinel.pNext->pNext->pNext != l.sentinel.pNext && l.sentinel.pNext->pNext->pNext != l.sentinel.pNext->pNext)
             {
-               if (l.pHead->pNext->pNext->pNext && l.pHead->pNext->pNext->pNext != l.pHead && l.pHead->pNext->pNext->pNext != l.pHead->pNext && l.pHead->pNext->pNext->pNext != l.pHead->pNext->pNext)
+               if (l.sentinel.pNext->pNext->pNext->pNext != &l.sentinel && l.sentinel.pNext->pNext->pNext->pNext != l.sentinel.pNext && l.sentinel.pNext->pNext->pNext->pNext != l.sentinel.pNext->pNext && l.sentinel.pNext->pNext->pNext->pNext != l.sentinel.pNext->pNext->pNext)
                {
-                  if (l.pHead->pNext->pNext->pNext->pNext && l.pHead->pNext->pNext->pNext->pNext != l.pHead && l.pHead->pNext->pNext->pNext->pNext != l.pHead->pNext && l.pHead->pNext->pNext->pNext->pNext != l.pHead->pNext->pNext && l.pHead->pNext->pNext->pNext->pNext != l.pHead->pNext->pNext->pNext)
-                     delete l.pHead->pNext->pNext->pNext->pNext;
-                  delete l.pHead->pNext->pNext->pNext;
+                  if (l.sentinel.pNext->pNext->pNext->pNext->pNext != &l.sentinel && l.sentinel.pNext->pNext->pNext->pNext->pNext != l.sentinel.pNext && l.sentinel.pNext->pNext->pNext->pNext->pNext != l.sentinel.pNext->pNext && l.sentinel.pNext->pNext->pNext->pNext->pNext != l.sentinel.pNext->pNext->pNext && l.sentinel.pNext->pNext->pNext->pNext->pNext != l.sentinel.pNext->pNext->pNext->pNext)
+                     delete l.sentinel.pNext->pNext->pNext->pNext->pNext;
+                  delete l.sentinel.pNext->pNext->pNext->pNext;
                }
-               delete l.pHead->pNext->pNext;
+               delete l.sentinel.pNext->pNext->pNext;
             }
-            delete l.pHead->pNext;
+            delete l.sentinel.pNext->pNext;
          }
-         delete l.pHead;
-         l.pHead = l.pTail = nullptr;
+         delete l.sentinel.pNext;
+         l.sentinel.pNext = l.sentinel.pPrev = &l.sentinel;
          l.numElements = 0;
       }
    }
@@ -1951,8 +4220,8 @@ public:
    {
       // verify the member variables
       assertIndirect(l.numElements == 0);
-      assertIndirect(l.pHead == nullptr);
-      assertIndirect(l.pTail == nullptr);
+      assertIndirect(l.sentinel.pNext == &l.sentinel);
+      assertIndirect(l.sentinel.pPrev == &l.sentinel);
    }
 
    /****************************************************************
@@ -1966,25 +4235,25 @@ public:
    {
       // verify the member variables
       assertIndirect(l.numElements == 3);
-      assertIndirect(l.pHead != nullptr);
-      assertIndirect(l.pTail != nullptr);
+      assertIndirect(l.sentinel.pNext != &l.sentinel);
+      assertIndirect(l.sentinel.pPrev != &l.sentinel);
 
       // verify the linked list 
-      if (l.pHead)
+      if (l.sentinel.pNext != &l.sentinel)
       {
-         assertIndirect(l.pHead->data == int(11));
-         assertIndirect(l.pHead->pNext != nullptr);
-         assertIndirect(l.pHead->pPrev == nullptr);
-         if (l.pHead->pNext)
+         assertIndirect(l.sentinel.pNext->node()->data == int(11));
+         assertIndirect(l.sentinel.pNext->pNext != &l.sentinel);
+         assertIndirect(l.sentinel.pNext->pPrev == &l.sentinel);
+         if (l.sentinel.pNext->pNext != &l.sentinel)
          {
-            assertIndirect(l.pHead->pNext->data == int(26));
-            assertIndirect(l.pHead->pNext->pNext == l.pTail);
-            assertIndirect(l.pHead->pNext->pPrev == l.pHead);
-            if (l.pHead->pNext->pNext)
+            assertIndirect(l.sentinel.pNext->pNext->node()->data == int(26));
+            assertIndirect(l.sentinel.pNext->pNext->pNext == l.sentinel.pPrev);
+            assertIndirect(l.sentinel.pNext->pNext->pPrev == l.sentinel.pNext);
+            if (l.sentinel.pNext->pNext->pNext != &l.sentinel)
             {
-               assertIndirect(l.pHead->pNext->pNext->data == int(31));
-               assertIndirect(l.pHead->pNext->pNext->pNext == nullptr);
-               assertIndirect(l.pHead->pNext->pNext->pPrev != nullptr);
+               assertIndirect(l.sentinel.pNext->pNext->pNext->node()->data == int(31));
+               assertIndirect(l.sentinel.pNext->pNext->pNext->pNext == &l.sentinel);
+               assertIndirect(l.sentinel.pNext->pNext->pNext->pPrev != &l.sentinel);
             }
          }
       }
@@ -0,0 +1,288 @@
+/***********************************************************************
+ * Header:
+ *    TEST PERSISTENT LIST
+ * Summary:
+ *    Unit tests for persistent_list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "persistent_list.h"
+#include "unitTest.h"
+
+#include <thread>
+#include <vector>
+
+class TestPersistentList : public UnitTest
+{
+public:
+   using List = custom::persistent_list<int>;
+
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructInit_standard();
+      test_constructCopy_shared();
+      test_assign_shared();
+      test_constructMove_standard();
+
+      // New versions
+      test_pushfront_shared();
+      test_popfront_shared();
+      test_popfront_empty();
+      test_set_path();
+      test_insert_path();
+      test_erase_path();
+
+      // Lifetime
+      test_release_last();
+      test_release_long();
+      test_release_threads();
+
+      report("PersistentList");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // default constructor, no allocations
+   void test_construct_default()
+   {  // exercise
+      List l;
+      // verify
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.empty());
+      assertUnit(l.begin() == l.end());
+   }  // teardown
+
+   // the standard fixture, each node held once
+   void test_constructInit_standard()
+   {  // exercise
+      List l{ 11, 26, 31 };
+      // verify
+      assertStandardFixture(l);
+   }  // teardown
+
+   // a copy is the same nodes, held twice
+   void test_constructCopy_shared()
+   {  // setup
+      List lSrc{ 11, 26, 31 };
+      // exercise
+      List lDes(lSrc);
+      // verify
+      assertUnit(lDes.pHead == lSrc.pHead);
+      assertUnit(lDes.size() == 3);
+      assertUnit(lSrc.pHead->refs == 2);
+      assertUnit(lSrc.pHead->pNext->refs == 1);
+   }  // teardown
+
+   // assignment lets go of the old nodes and shares the new
+   void test_assign_shared()
+   {  // setup
+      List lSrc{ 11, 26, 31 };
+      List lDes{ 99 };
+      // exercise
+      lDes = lSrc;
+      lDes = lDes;
+      // verify
+      assertUnit(lDes.pHead == lSrc.pHead);
+      assertUnit(lSrc.pHead->refs == 2);
+      assertStandardFixture(lDes);
+   }  // teardown
+
+   // moving takes the reference without counting
+   void test_constructMove_standard()
+   {  // setup
+      List lSrc{ 11, 26, 31 };
+      List::Node* p = lSrc.pHead;
+      // exercise
+      List lDes(std::move(lSrc));
+      // verify
+      assertUnit(lDes.pHead == p);
+      assertUnit(p->refs == 1);
+      assertUnit(lSrc.pHead == nullptr);
+      assertUnit(lSrc.empty());
+      assertStandardFixture(lDes);
+   }  // teardown
+
+   /***************************************
+    * NEW VERSIONS
+    ***************************************/
+
+   // the new version points at the whole of the old one
+   void test_pushfront_shared()
+   {  // setup
+      List lOld{ 11, 26, 31 };
+      // exercise
+      List lNew = lOld.push_front(5);
+      // verify
+      assertStandardFixture(lOld);
+      assertUnit(lNew.size() == 4);
+      assertUnit(lNew.front() == 5);
+      assertUnit(lNew.pHead->pNext == lOld.pHead);
+      assertUnit(lOld.pHead->refs == 2);
+   }  // teardown
+
+   // the new version is the tail of the old one
+   void test_popfront_shared()
+   {  // setup
+      List lOld{ 5, 11, 26, 31 };
+      // exercise
+      List lNew = lOld.pop_front();
+      // verify
+      assertUnit(lOld.size() == 4);
+      assertUnit(lOld.front() == 5);
+      assertUnit(lNew.pHead == lOld.pHead->pNext);
+      assertStandardFixture(lNew);
+   }  // teardown
+
+   // popping an empty list is still empty
+   void test_popfront_empty()
+   {  // setup
+      List l;
+      // exercise
+      List lNew = l.pop_front();
+      // verify
+      assertUnit(lNew.empty());
+      assertUnit(lNew.pHead == nullptr);
+   }  // teardown
+
+   // changing the middle copies what is in front and shares the rest
+   void test_set_path()
+   {  // setup
+      List lOld{ 11, 26, 31, 49, 67 };
+      // exercise
+      List lNew = lOld.set(2, 99);
+      // verify
+      assertUnit(std::vector<int>(lOld.begin(), lOld.end()) == std::vector<int>({ 11, 26, 31, 49, 67 }));
+      assertUnit(std::vector<int>(lNew.begin(), lNew.end()) == std::vector<int>({ 11, 26, 99, 49, 67 }));
+      assertUnit(lNew.size() == 5);
+      assertUnit(lNew.pHead != lOld.pHead);
+      assertUnit(lNew.pHead->pNext != lOld.pHead->pNext);
+      assertUnit(lNew.pHead->pNext->pNext->pNext == lOld.pHead->pNext->pNext->pNext);
+      assertUnit(lOld.pHead->pNext->pNext->pNext->refs == 2);
+   }  // teardown
+
+   // inserting shares the node that ends up after the new one
+   void test_insert_path()
+   {  // setup
+      List lOld{ 11, 31 };
+      // exercise
+      List lNew = lOld.insert(1, 26);
+      List lEnd = lOld.insert(2, 49);
+      // verify
+      assertStandardFixture(lNew);
+      assertUnit(lNew.pHead->pNext->pNext == lOld.pHead->pNext);
+      assertUnit(std::vector<int>(lEnd.begin(), lEnd.end()) == std::vector<int>({ 11, 31, 49 }));
+      assertUnit(lEnd.size() == 3);
+      assertUnit(lOld.size() == 2);
+   }  // teardown
+
+   // erasing shares everything after the erased node
+   void test_erase_path()
+   {  // setup
+      List lOld{ 11, 26, 99, 31 };
+      // exercise
+      List lNew = lOld.erase(2);
+      List lFront = lOld.erase(0);
+      // verify
+      assertStandardFixture(lNew);
+      assertUnit(lNew.pHead->pNext->pNext == lOld.pHead->pNext->pNext->pNext);
+      assertUnit(lFront.pHead == lOld.pHead->pNext);
+      assertUnit(lOld.size() == 4);
+   }  // teardown
+
+   /***************************************
+    * LIFETIME
+    ***************************************/
+
+   // nodes go when the last version holding them does
+   void test_release_last()
+   {  // setup
+      Counted::live = 0;
+      {
+         custom::persistent_list<Counted> lOld{ Counted(), Counted(), Counted() };
+         assertUnit(Counted::live == 3);
+         custom::persistent_list<Counted> lNew = lOld.erase(1);
+         assertUnit(Counted::live == 4);
+         // exercise
+         lOld = custom::persistent_list<Counted>();
+         // verify
+         assertUnit(Counted::live == 2);
+      }
+      assertUnit(Counted::live == 0);
+   }  // teardown
+
+   // a very long list is let go of without recursing
+   void test_release_long()
+   {  // setup
+      List l;
+      for (int i = 0; i < 200000; i++)
+         l = l.push_front(i);
+      // exercise
+      l = List();
+      // verify
+      assertUnit(l.empty());
+   }  // teardown
+
+   // readers on other threads copy and drop a shared snapshot
+   void test_release_threads()
+   {  // setup
+      List l{ 11, 26, 31 };
+      std::vector<std::thread> readers;
+      // exercise
+      for (int t = 0; t < 4; t++)
+         readers.emplace_back([&l]()
+         {
+            for (int i = 0; i < 1000; i++)
+            {
+               List lMine(l);
+               lMine = lMine.push_front(i).pop_front();
+            }
+         });
+      for (auto& reader : readers)
+         reader.join();
+      // verify
+      assertUnit(l.pHead->refs == 1);
+      assertStandardFixture(l);
+   }  // teardown
+
+   // an element that counts how many of it are alive
+
+   struct Counted
+   {
+      Counted() { live++; }
+      Counted(const Counted&) { live++; }
+      ~Counted() { live--; }
+      inline static int live = 0;
+   };
+
+   /****************************************************************
+    * Verify Standard Fixture
+    *    +----+   +----+   +----+
+    *    | 11 | > | 26 | > | 31 | > null
+    *    +----+   +----+   +----+
+    ****************************************************************/
+   void assertStandardFixtureParameters(List& l, int line, const char* function)
+   {
+      assertIndirect(l.numElements == 3);
+      assertIndirect(l.pHead != nullptr);
+      if (l.pHead && l.pHead->pNext && l.pHead->pNext->pNext)
+      {
+         assertIndirect(l.pHead->data == 11);
+         assertIndirect(l.pHead->pNext->data == 26);
+         assertIndirect(l.pHead->pNext->pNext->data == 31);
+         assertIndirect(l.pHead->pNext->pNext->pNext == nullptr);
+      }
+   }
+};
+
+#endif // DEBUG
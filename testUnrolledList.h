@@ -0,0 +1,344 @@
+/***********************************************************************
+ * Header:
+ *    TEST UNROLLED LIST
+ * Summary:
+ *    Unit tests for unrolled_list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "unrolled_list.h"
+#include "unitTest.h"
+
+#include <string>
+#include <vector>
+
+class TestUnrolledList : public UnitTest
+{
+public:
+   // four to a chunk keeps the fixtures small
+   using List = custom::unrolled_list<int, 4>;
+
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructInit_standard();
+      test_constructCopy_standard();
+      test_constructMove_standard();
+
+      // Insert
+      test_pushback_fillChunks();
+      test_pushfront_standard();
+      test_insert_split();
+      test_insert_strings();
+
+      // Remove
+      test_erase_standardMiddle();
+      test_erase_freeChunk();
+      test_erase_merge();
+      test_popback_standard();
+      test_popfront_empty();
+      test_clear_standard();
+
+      // Iterator
+      test_iterator_walk();
+      test_iterator_decrementEnd();
+      test_iterator_reverse();
+
+      report("UnrolledList");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // default constructor, no allocations
+   void test_construct_default()
+   {  // exercise
+      List l;
+      // verify
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+      assertUnit(l.empty());
+      assertUnit(l.begin() == l.end());
+   }  // teardown
+
+   // the standard fixture fits in one chunk
+   void test_constructInit_standard()
+   {  // exercise
+      List l{ 11, 26, 31 };
+      // verify
+      assertStandardFixture(l);
+   }  // teardown
+
+   // a copy has its own chunks
+   void test_constructCopy_standard()
+   {  // setup
+      List lSrc{ 11, 26, 31 };
+      // exercise
+      List lDest(lSrc);
+      // verify
+      assertUnit(lSrc.pHead != lDest.pHead);
+      assertStandardFixture(lSrc);
+      assertStandardFixture(lDest);
+   }  // teardown
+
+   // a move takes the chunks
+   void test_constructMove_standard()
+   {  // setup
+      List lSrc{ 11, 26, 31 };
+      List::Chunk* p = lSrc.pHead;
+      // exercise
+      List lDest(std::move(lSrc));
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(lSrc.pHead == nullptr);
+      assertUnit(lDest.pHead == p);
+      assertStandardFixture(lDest);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // pushing on the back fills each chunk before starting the next
+   void test_pushback_fillChunks()
+   {  // setup
+      List l;
+      // exercise
+      for (int i = 0; i < 9; i++)
+         l.push_back(i);
+      // verify
+      assertUnit(l.size() == 9);
+      assertUnit(l.pHead->count == 4);
+      assertUnit(l.pHead->pNext->count == 4);
+      assertUnit(l.pTail->count == 1);
+      assertUnit(l.pTail->pPrev == l.pHead->pNext);
+      assertUnit(l.back() == 8);
+   }  // teardown
+
+   // push onto the front of the standard fixture
+   void test_pushfront_standard()
+   {  // setup
+      List l{ 11, 26, 31 };
+      // exercise
+      l.push_front(int(99));
+      // verify
+      assertUnit(l.size() == 4);
+      assertUnit(l.pHead == l.pTail);
+      assertUnit(l.front() == 99);
+      assertUnit(l.pHead->value(1) == 11);
+      assertUnit(l.back() == 31);
+   }  // teardown
+
+   // inserting into a full chunk splits it in half
+   void test_insert_split()
+   {  // setup
+      List l{ 11, 26, 31, 42 };
+      List::iterator it = l.begin();
+      ++it;
+      ++it;
+      ++it;
+      // exercise
+      it = l.insert(it, int(99));
+      // verify
+      assertUnit(*it == 99);
+      assertUnit(l.size() == 5);
+      assertUnit(l.pHead->count == 2);
+      assertUnit(l.pTail->count == 3);
+      assertUnit(it.p == l.pTail);
+      int expected[] = { 11, 26, 31, 99, 42 };
+      int i = 0;
+      for (List::iterator itCheck = l.begin(); itCheck != l.end(); ++itCheck)
+         assertUnit(*itCheck == expected[i++]);
+      assertUnit(i == 5);
+   }  // teardown
+
+   // elements that own memory survive being slid around
+   void test_insert_strings()
+   {  // setup
+      custom::unrolled_list<std::string, 2> l;
+      l.push_back(std::string("one"));
+      l.push_back(std::string("three"));
+      // exercise
+      auto it = l.begin();
+      ++it;
+      l.insert(it, std::string("two"));
+      l.push_front(std::string("zero"));
+      // verify
+      std::string all;
+      for (auto itCheck = l.begin(); itCheck != l.end(); ++itCheck)
+         all += *itCheck + " ";
+      assertUnit(all == std::string("zero one two three "));
+      assertUnit(l.size() == 4);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // erase from the middle of the standard fixture
+   void test_erase_standardMiddle()
+   {  // setup
+      List l{ 11, 26, 31 };
+      List::iterator it = l.begin();
+      ++it;
+      // exercise
+      it = l.erase(it);
+      // verify
+      assertUnit(*it == 31);
+      assertUnit(l.size() == 2);
+      assertUnit(l.pHead->count == 2);
+      assertUnit(l.front() == 11);
+      assertUnit(l.back() == 31);
+   }  // teardown
+
+   // erasing the last element of a chunk frees the chunk
+   void test_erase_freeChunk()
+   {  // setup
+      List l{ 11, 26, 31, 42, 57 };
+      List::iterator it = l.begin();
+      for (int i = 0; i < 4; i++)
+         ++it;
+      // exercise
+      it = l.erase(it);
+      // verify
+      assertUnit(it == l.end());
+      assertUnit(l.pHead == l.pTail);
+      assertUnit(l.size() == 4);
+   }  // teardown
+
+   // a chunk under half full absorbs its neighbour
+   void test_erase_merge()
+   {  // setup
+      //    +-------------+   +-------+
+      //    | 11 26 31 42 | - | 57 63 |
+      //    +-------------+   +-------+
+      List l{ 11, 26, 31, 42, 57, 63 };
+      l.erase(l.begin());
+      l.erase(l.begin());
+      // exercise
+      List::iterator it = l.erase(l.begin());
+      // verify
+      //    +----------+
+      //    | 42 57 63 |
+      //    +----------+
+      assertUnit(*it == 42);
+      assertUnit(l.pHead == l.pTail);
+      assertUnit(l.pHead->count == 3);
+      assertUnit(l.size() == 3);
+      assertUnit(l.back() == 63);
+   }  // teardown
+
+   // pop the back of the standard fixture
+   void test_popback_standard()
+   {  // setup
+      List l{ 11, 26, 31, 99 };
+      // exercise
+      l.pop_back();
+      // verify
+      assertStandardFixture(l);
+   }  // teardown
+
+   // popping an empty list does nothing
+   void test_popfront_empty()
+   {  // setup
+      List l;
+      // exercise
+      l.pop_front();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+   }  // teardown
+
+   // clear frees every chunk
+   void test_clear_standard()
+   {  // setup
+      List l{ 11, 26, 31, 42, 57, 63 };
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+   }  // teardown
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // walk forward across chunks and back again
+   void test_iterator_walk()
+   {  // setup
+      List l{ 11, 26, 31, 42, 57 };
+      int sum = 0;
+      List::iterator it;
+      // exercise
+      for (it = l.begin(); it != l.end(); ++it)
+         sum += *it;
+      it = List::iterator(&l, l.pTail, 0);
+      --it;
+      // verify
+      assertUnit(sum == 11 + 26 + 31 + 42 + 57);
+      assertUnit(*it == 42);
+      assertUnit(it.p == l.pHead);
+   }  // teardown
+
+   // stepping back from the end lands on the last element of the tail
+   void test_iterator_decrementEnd()
+   {  // setup
+      List l{ 11, 26, 31, 42, 57, 68 };
+      List::iterator it = l.end();
+      // exercise
+      --it;
+      // verify
+      assertUnit(*it == 68);
+      assertUnit(it.p == l.pTail);
+      assertUnit(it.i == 1);
+      it--;
+      assertUnit(*it == 57);
+   }  // teardown
+
+   // walk the list backwards across chunk boundaries
+   void test_iterator_reverse()
+   {  // setup
+      List l{ 11, 26, 31, 42, 57, 68, 73, 84, 99 };
+      std::vector<int> v;
+      // exercise
+      for (List::reverse_iterator it = l.rbegin(); it != l.rend(); ++it)
+         v.push_back(*it);
+      // verify
+      assertUnit(v == std::vector<int>({ 99, 84, 73, 68, 57, 42, 31, 26, 11 }));
+   }  // teardown
+
+   /****************************************************************
+    * Verify Standard Fixture
+    *       +------------+
+    *       | 11 26 31 _ |
+    *       +------------+
+    ****************************************************************/
+   void assertStandardFixtureParameters(List& l, int line, const char* function)
+   {
+      assertIndirect(l.numElements == 3);
+      assertIndirect(l.pHead != nullptr);
+      assertIndirect(l.pHead == l.pTail);
+      if (l.pHead)
+      {
+         assertIndirect(l.pHead->count == 3);
+         assertIndirect(l.pHead->value(0) == 11);
+         assertIndirect(l.pHead->value(1) == 26);
+         assertIndirect(l.pHead->value(2) == 31);
+         assertIndirect(l.pHead->pNext == nullptr);
+         assertIndirect(l.pHead->pPrev == nullptr);
+      }
+   }
+};
+
+#endif // DEBUG
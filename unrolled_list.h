@@ -0,0 +1,474 @@
+/***********************************************************************
+ * Header:
+ *    UNROLLED LIST
+ * Summary:
+ *    A doubly linked list of chunks, each chunk holding up to K
+ *    elements side by side. A scan follows one pointer per K
+ *    elements instead of one per element, and the elements of a
+ *    chunk share cache lines.
+ *
+ *    This will contain the class definition of:
+ *        unrolled_list           : a list of element chunks
+ *        unrolled_list::iterator : an iterator through the list
+ * Author
+ *    Alexander Dohms, Stephen Costigan, Shaun Crook, Jonathan Colwell
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstddef>     // for size_t
+#include <iterator>    // for std::reverse_iterator
+#include <memory>      // for std::allocator
+#include <new>         // for placement new
+#include <utility>     // for std::move
+
+namespace custom
+{
+
+    /**************************************************
+     * UNROLLED LIST
+     * Just like custom::list, with up to K elements per node.
+     * A full chunk splits in half on insert; a chunk that
+     * falls under half full on erase absorbs its successor
+     * when they fit together. Inserting or erasing moves the
+     * elements after it in the same chunk, so it invalidates
+     * iterators into that chunk and the one it split or merged
+     * with.
+     **************************************************/
+    template <typename T, size_t K = 16, typename A = std::allocator<T>>
+    class unrolled_list
+    {
+        static_assert(K >= 2, "a chunk has to hold at least two elements to split");
+
+    public:
+        //
+        // Construct
+        //
+
+        unrolled_list() : numElements(0), pHead(nullptr), pTail(nullptr), alloc() { }
+        explicit unrolled_list(const A& a) : numElements(0), pHead(nullptr), pTail(nullptr), alloc(a) { }
+        unrolled_list(const std::initializer_list<T>& il, const A& a = A());
+        unrolled_list(const unrolled_list& rhs);
+        unrolled_list(unrolled_list&& rhs);
+        ~unrolled_list() { clear(); }
+
+        //
+        // Assign
+        //
+
+        unrolled_list& operator = (const unrolled_list& rhs);
+        unrolled_list& operator = (unrolled_list&& rhs);
+
+        //
+        // Iterator
+        //
+
+        class iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        iterator begin() { return iterator(this, pHead, 0); }
+        iterator end() { return iterator(this, nullptr, 0); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+
+        //
+        // Access
+        //
+
+        T& front() { assert(!empty()); return pHead->value(0); }
+        T& back() { assert(!empty()); return pTail->value(pTail->count - 1); }
+
+        //
+        // Insert
+        //
+
+        void push_front(const T& data) { insert(begin(), data); }
+        void push_front(T&& data) { insert(begin(), std::move(data)); }
+        void push_back(const T& data) { insert(end(), data); }
+        void push_back(T&& data) { insert(end(), std::move(data)); }
+        iterator insert(iterator it, const T& data) { return emplace(it, data); }
+        iterator insert(iterator it, T&& data) { return emplace(it, std::move(data)); }
+
+        //
+        // Remove
+        //
+
+        void pop_back() { if (!empty()) erase(iterator(this, pTail, pTail->count - 1)); }
+        void pop_front() { if (!empty()) erase(begin()); }
+        void clear();
+        iterator erase(const iterator& it);
+
+        //
+        // Status
+        //
+
+        bool empty() const { return numElements == 0; }
+        size_t size() const { return numElements; }
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        // a node holding up to K elements, always at least one
+        struct Chunk
+        {
+            Chunk* pNext;   // next chunk, or nullptr at the tail
+            Chunk* pPrev;   // previous chunk, or nullptr at the head
+            size_t count;   // elements [0, count) are constructed
+            alignas(T) unsigned char data[K * sizeof(T)];
+
+            T& value(size_t i) { return reinterpret_cast<T*>(data)[i]; }
+            T* slot(size_t i) { return reinterpret_cast<T*>(data) + i; }
+        };
+
+        using chunk_allocator = typename std::allocator_traits<A>::template rebind_alloc<Chunk>;
+        using chunk_traits = std::allocator_traits<chunk_allocator>;
+
+        template <class U>
+        iterator emplace(iterator it, U&& data);
+        Chunk* newChunk(Chunk* pPrev);
+        void deleteChunk(Chunk* p);
+
+        // member variables
+        size_t numElements;    // elements in all the chunks together
+        Chunk* pHead;          // first chunk
+        Chunk* pTail;          // last chunk
+        chunk_allocator alloc; // where the chunks come from
+    };
+
+    /*************************************************
+     * UNROLLED LIST ITERATOR
+     * A chunk and a position within it
+     ************************************************/
+    template <typename T, size_t K, typename A>
+    class unrolled_list <T, K, A> ::iterator
+    {
+    public:
+        // what std::reverse_iterator and the algorithms need to know
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() : pList(nullptr), p(nullptr), i(0) { }
+        iterator(unrolled_list* pList, Chunk* p, size_t i) : pList(pList), p(p), i(i) { }
+
+        bool operator != (const iterator& rhs) const { return rhs.p != p || rhs.i != i; }
+        bool operator == (const iterator& rhs) const { return rhs.p == p && rhs.i == i; }
+
+        T& operator * () const { return p->value(i); }
+        T* operator -> () const { return p->slot(i); }
+
+        // prefix increment
+        iterator& operator ++ ()
+        {
+            if (++i == p->count)
+            {
+                p = p->pNext;
+                i = 0;
+            }
+            return *this;
+        }
+        iterator operator ++ (int postfix) { iterator it(*this); ++*this; return it; }
+
+        // prefix decrement, from end() to the last element of the tail
+        iterator& operator -- ()
+        {
+            if (p == nullptr)
+            {
+                p = pList->pTail;
+                i = p->count - 1;
+            }
+            else if (i == 0)
+            {
+                p = p->pPrev;
+                i = p ? p->count - 1 : 0;
+            }
+            else
+                i--;
+            return *this;
+        }
+        iterator operator -- (int postfix) { iterator it(*this); --*this; return it; }
+
+        friend class unrolled_list <T, K, A>;
+
+#ifdef DEBUG // make this visible to the unit tests
+    public:
+#else
+    private:
+#endif
+        unrolled_list* pList; // whose tail end() steps back to
+        Chunk* p;             // which chunk, nullptr for end()
+        size_t i;             // which element in the chunk
+    };
+
+    /*****************************************
+     * UNROLLED LIST :: INITIALIZER constructor
+     ****************************************/
+    template <typename T, size_t K, typename A>
+    unrolled_list <T, K, A> ::unrolled_list(const std::initializer_list<T>& il, const A& a) :
+        numElements(0), pHead(nullptr), pTail(nullptr), alloc(a)
+    {
+        for (const T& item : il)
+            push_back(item);
+    }
+
+    /*****************************************
+     * UNROLLED LIST :: COPY constructor
+     ****************************************/
+    template <typename T, size_t K, typename A>
+    unrolled_list <T, K, A> ::unrolled_list(const unrolled_list& rhs) :
+        numElements(0), pHead(nullptr), pTail(nullptr),
+        alloc(chunk_traits::select_on_container_copy_construction(rhs.alloc))
+    {
+        *this = rhs;
+    }
+
+    /*****************************************
+     * UNROLLED LIST :: MOVE constructor
+     * Steal the chunks from the RHS
+     ****************************************/
+    template <typename T, size_t K, typename A>
+    unrolled_list <T, K, A> ::unrolled_list(unrolled_list&& rhs) :
+        numElements(rhs.numElements), pHead(rhs.pHead), pTail(rhs.pTail), alloc(std::move(rhs.alloc))
+    {
+        rhs.pHead = rhs.pTail = nullptr;
+        rhs.numElements = 0;
+    }
+
+    /**********************************************
+     * UNROLLED LIST :: assignment operator
+     * Copy one list onto another. The copy is packed
+     * into full chunks.
+     *     INPUT  : a list to be copied
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of elements
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    unrolled_list <T, K, A>& unrolled_list <T, K, A> :: operator = (const unrolled_list& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        clear();
+        for (Chunk* p = rhs.pHead; p; p = p->pNext)
+            for (size_t i = 0; i < p->count; i++)
+                push_back(p->value(i));
+        return *this;
+    }
+
+    /**********************************************
+     * UNROLLED LIST :: assignment operator - MOVE
+     *     INPUT  : a list to be moved
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the size of the LHS
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    unrolled_list <T, K, A>& unrolled_list <T, K, A> :: operator = (unrolled_list&& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        clear();
+
+        // without the same allocator we cannot free their chunks
+        if (!chunk_traits::propagate_on_container_move_assignment::value && alloc != rhs.alloc)
+        {
+            for (Chunk* p = rhs.pHead; p; p = p->pNext)
+                for (size_t i = 0; i < p->count; i++)
+                    push_back(std::move(p->value(i)));
+            rhs.clear();
+            return *this;
+        }
+
+        if constexpr (chunk_traits::propagate_on_container_move_assignment::value)
+            alloc = std::move(rhs.alloc);
+        pHead = rhs.pHead;
+        pTail = rhs.pTail;
+        numElements = rhs.numElements;
+        rhs.pHead = rhs.pTail = nullptr;
+        rhs.numElements = 0;
+        return *this;
+    }
+
+    /*********************************************
+     * UNROLLED LIST :: NEW CHUNK
+     * Allocate an empty chunk and link it after pPrev,
+     * or at the head if pPrev is nullptr
+     *     INPUT  : the chunk to follow
+     *     OUTPUT : the new chunk
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    typename unrolled_list <T, K, A> ::Chunk* unrolled_list <T, K, A> ::newChunk(Chunk* pPrev)
+    {
+        Chunk* pNew = chunk_traits::allocate(alloc, 1);
+        ::new (static_cast<void*>(pNew)) Chunk;
+        pNew->count = 0;
+        pNew->pPrev = pPrev;
+        pNew->pNext = pPrev ? pPrev->pNext : pHead;
+
+        if (pNew->pNext)
+            pNew->pNext->pPrev = pNew;
+        else
+            pTail = pNew;
+        if (pPrev)
+            pPrev->pNext = pNew;
+        else
+            pHead = pNew;
+        return pNew;
+    }
+
+    /*********************************************
+     * UNROLLED LIST :: DELETE CHUNK
+     * Unlink an empty chunk and free it
+     *     INPUT  : a chunk with no elements left
+     *     OUTPUT :
+     *     COST   : O(1)
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    void unrolled_list <T, K, A> ::deleteChunk(Chunk* p)
+    {
+        assert(p->count == 0);
+        if (p->pNext)
+            p->pNext->pPrev = p->pPrev;
+        else
+            pTail = p->pPrev;
+        if (p->pPrev)
+            p->pPrev->pNext = p->pNext;
+        else
+            pHead = p->pNext;
+        chunk_traits::deallocate(alloc, p, 1);
+    }
+
+    /*********************************************
+     * UNROLLED LIST :: EMPLACE
+     * Put a new element in front of the iterator,
+     * splitting the chunk first if it is full
+     *     INPUT  : where to put it and the value
+     *     OUTPUT : iterator to the new element
+     *     COST   : O(K)
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    template <class U>
+    typename unrolled_list <T, K, A> ::iterator unrolled_list <T, K, A> ::emplace(iterator it, U&& data)
+    {
+        // build the element first so a throwing constructor leaves the list alone
+        T value(std::forward<U>(data));
+
+        // the end goes after the last element of the tail
+        if (it.p == nullptr)
+        {
+            if (pTail == nullptr || pTail->count == K)
+                newChunk(pTail);
+            it = iterator(this, pTail, pTail->count);
+        }
+
+        Chunk* p = it.p;
+        size_t i = it.i;
+
+        // a full chunk gives its upper half to a new one
+        if (p->count == K)
+        {
+            Chunk* pNew = newChunk(p);
+            const size_t half = K / 2;
+            for (size_t j = half; j < K; j++)
+            {
+                ::new (static_cast<void*>(pNew->slot(j - half))) T(std::move(p->value(j)));
+                p->value(j).~T();
+            }
+            pNew->count = K - half;
+            p->count = half;
+            if (i > half)
+            {
+                p = pNew;
+                i -= half;
+            }
+        }
+
+        // slide the later elements up one to open slot i
+        if (i == p->count)
+            ::new (static_cast<void*>(p->slot(i))) T(std::move(value));
+        else
+        {
+            ::new (static_cast<void*>(p->slot(p->count))) T(std::move(p->value(p->count - 1)));
+            for (size_t j = p->count - 1; j > i; j--)
+                p->value(j) = std::move(p->value(j - 1));
+            p->value(i) = std::move(value);
+        }
+        p->count++;
+        numElements++;
+        return iterator(this, p, i);
+    }
+
+    /*********************************************
+     * UNROLLED LIST :: ERASE
+     * Remove an element, freeing its chunk if it empties
+     * or folding the next chunk in if both are small
+     *     INPUT  : iterator to the element
+     *     OUTPUT : iterator to the element after it
+     *     COST   : O(K)
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    typename unrolled_list <T, K, A> ::iterator unrolled_list <T, K, A> ::erase(const iterator& it)
+    {
+        Chunk* p = it.p;
+        size_t i = it.i;
+        if (p == nullptr)
+            return end();
+
+        for (size_t j = i; j + 1 < p->count; j++)
+            p->value(j) = std::move(p->value(j + 1));
+        p->value(--p->count).~T();
+        numElements--;
+
+        if (p->count == 0)
+        {
+            Chunk* pNext = p->pNext;
+            deleteChunk(p);
+            return iterator(this, pNext, 0);
+        }
+
+        // under half full: pull in the next chunk if it all fits
+        Chunk* pNext = p->pNext;
+        if (p->count < K / 2 && pNext && p->count + pNext->count <= K)
+        {
+            for (size_t j = 0; j < pNext->count; j++)
+            {
+                ::new (static_cast<void*>(p->slot(p->count + j))) T(std::move(pNext->value(j)));
+                pNext->value(j).~T();
+            }
+            p->count += pNext->count;
+            pNext->count = 0;
+            deleteChunk(pNext);
+        }
+
+        if (i < p->count)
+            return iterator(this, p, i);
+        return iterator(this, p->pNext, 0);
+    }
+
+    /*********************************************
+     * UNROLLED LIST :: CLEAR
+     * Destroy every element and free every chunk
+     *     INPUT  :
+     *     OUTPUT :
+     *     COST   : O(n) with respect to the number of elements
+     *********************************************/
+    template <typename T, size_t K, typename A>
+    void unrolled_list <T, K, A> ::clear()
+    {
+        while (pHead)
+        {
+            Chunk* pDelete = pHead;
+            pHead = pHead->pNext;
+            for (size_t i = 0; i < pDelete->count; i++)
+                pDelete->value(i).~T();
+            chunk_traits::deallocate(alloc, pDelete, 1);
+        }
+        pTail = nullptr;
+        numElements = 0;
+    }
+
+}; // namespace custom